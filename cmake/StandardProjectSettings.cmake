@@ -38,6 +38,13 @@ if (DISASSEMBLE)
   add_compile_definitions(LITR_ENABLE_DISASSEMBLE)
 endif ()
 
+option(BENCHMARKS "Build the benchmark suite for Litr's own hot paths" OFF)
+
+option(ALLOCATIONS "Count heap allocations per phase and print a summary at exit" OFF)
+if (ALLOCATIONS)
+  add_compile_definitions(LITR_TRACK_ALLOCATIONS)
+endif ()
+
 option(PROFILE "Enable profiling tools" OFF)
 if (PROFILE)
   add_compile_definitions(LITR_PROFILE)
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <memory>
+#include <string>
+
+#include "Core/CLI/Instruction.hpp"
+#include "Core/CLI/Parser.hpp"
+#include "Core/CLI/Scanner.hpp"
+#include "Core/Error/Handler.hpp"
+
+/** @private */
+static std::string create_arguments(int64_t commands) {
+  std::string source{};
+
+  for (int64_t index{0}; index < commands; ++index) {
+    if (index > 0) {
+      source.append(",");
+    }
+    source.append(fmt::format(R"( --target="release" -d build command-{} child)", index));
+  }
+
+  return source;
+}
+
+static void CLI_Scanner(benchmark::State& state) {
+  const std::string source{create_arguments(state.range(0))};
+
+  for (auto _ : state) {
+    Litr::CLI::Scanner scanner{source.c_str()};
+    for (Litr::CLI::Token token{scanner.scan_token()}; token.type != Litr::CLI::TokenType::EOS;
+         token = scanner.scan_token()) {
+      benchmark::DoNotOptimize(token);
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(source.size()));
+}
+BENCHMARK(CLI_Scanner)->RangeMultiplier(8)->Range(1, 4096);
+
+static void CLI_Parser(benchmark::State& state) {
+  const std::string source{create_arguments(state.range(0))};
+
+  for (auto _ : state) {
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    const Litr::CLI::Parser parser{instruction, source};
+    benchmark::DoNotOptimize(instruction->count());
+  }
+
+  // These arguments are valid, nothing should be left, but errors must not pile up.
+  Litr::Error::Handler::flush();
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(source.size()));
+}
+BENCHMARK(CLI_Parser)->RangeMultiplier(8)->Range(1, 4096);
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <string>
+
+#include "Core/CLI/Shell.hpp"
+
+static void CLI_Shell_exec(benchmark::State& state) {
+  // Output the given amount of lines with 80 characters each.
+  constexpr size_t line_length{79};
+  const std::string command{
+      fmt::format("yes {} | head -n {}", std::string(line_length, '0'), state.range(0))};
+  int64_t bytes{0};
+
+  for (auto _ : state) {
+    const Litr::CLI::Shell::Result result{
+        Litr::CLI::Shell::exec(command, [](const std::string& line) {
+          benchmark::DoNotOptimize(line.data());
+        })};
+    bytes += static_cast<int64_t>(result.message.size());
+  }
+
+  state.SetBytesProcessed(bytes);
+}
+BENCHMARK(CLI_Shell_exec)->RangeMultiplier(10)->Range(1, 100000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <memory>
+#include <string>
+
+#include "Core/Config/Loader.hpp"
+#include "Core/Config/Query.hpp"
+#include "Core/Error/Handler.hpp"
+#include "Helpers/Config.hpp"
+
+/** @private */
+static Litr::Path get_config_path(int64_t commands) {
+  ConfigShape shape{};
+  shape.commands = static_cast<size_t>(commands);
+  shape.depth = 2;
+  return write_config(fmt::format("commands-{}", commands), create_config(shape));
+}
+
+static void Config_Loader(benchmark::State& state) {
+  const Litr::Path path{get_config_path(state.range(0))};
+
+  for (auto _ : state) {
+    Litr::Config::Loader config{path};
+    benchmark::DoNotOptimize(config.get_commands().size());
+  }
+
+  Litr::Error::Handler::flush();
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Config_Loader)->Arg(10)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void Config_Loader_Lazy(benchmark::State& state) {
+  const Litr::Path path{get_config_path(state.range(0))};
+  const std::string name{fmt::format("command-{}", state.range(0) - 1)};
+
+  for (auto _ : state) {
+    Litr::Config::Loader config{path, Litr::Config::Loader::Mode::LAZY};
+    benchmark::DoNotOptimize(config.get_command(name));
+  }
+
+  Litr::Error::Handler::flush();
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Config_Loader_Lazy)->Arg(10)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void Config_Query_get_command(benchmark::State& state) {
+  const auto config{std::make_shared<Litr::Config::Loader>(get_config_path(state.range(0)))};
+  const Litr::Config::Query query{config};
+  // The last command is the worst case for a lookup.
+  const std::string name{fmt::format("command-{}.level-1", state.range(0) - 1)};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(query.get_command(name));
+  }
+
+  Litr::Error::Handler::flush();
+}
+BENCHMARK(Config_Query_get_command)->Arg(10)->Arg(1000)->Arg(10000);
+
+static void Config_Query_get_parameters(benchmark::State& state) {
+  const auto config{std::make_shared<Litr::Config::Loader>(get_config_path(state.range(0)))};
+  const Litr::Config::Query query{config};
+  const std::string name{fmt::format("command-{}", state.range(0) - 1)};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(query.get_parameters(name));
+  }
+
+  Litr::Error::Handler::flush();
+}
+BENCHMARK(Config_Query_get_parameters)->Arg(10)->Arg(1000)->Arg(10000);
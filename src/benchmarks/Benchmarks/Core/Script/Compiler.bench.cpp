@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "Core/CLI/Variable.hpp"
+#include "Core/Config/Location.hpp"
+#include "Core/Error/Handler.hpp"
+#include "Core/Script/Compiler.hpp"
+#include "Core/Script/Scanner.hpp"
+
+/** @private */
+static std::string create_script(int64_t lines) {
+  std::string script{};
+
+  for (int64_t line{0}; line < lines; ++line) {
+    script.append(
+        R"(cmake -B build/%{target} %{debug '-DDEBUG=ON'} %{trace '-DTRACE=ON' or '-DTRACE=OFF'} )"
+        "&& echo \"some untouched script content\"\n");
+  }
+
+  return script;
+}
+
+/** @private */
+static Litr::Script::Compiler::Variables create_variables() {
+  Litr::Script::Compiler::Variables variables{};
+  variables.insert_or_assign("target", Litr::CLI::Variable{"target", std::string{"release"}});
+  variables.insert_or_assign("debug", Litr::CLI::Variable{"debug", true});
+  variables.insert_or_assign("trace", Litr::CLI::Variable{"trace", false});
+  return variables;
+}
+
+static void Script_Scanner(benchmark::State& state) {
+  const std::string script{create_script(state.range(0))};
+
+  for (auto _ : state) {
+    Litr::Script::Scanner scanner{script.c_str()};
+    for (Litr::Script::Token token{scanner.scan_token()};
+         token.type != Litr::Script::TokenType::EOS;
+         token = scanner.scan_token()) {
+      benchmark::DoNotOptimize(token);
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(script.size()));
+}
+BENCHMARK(Script_Scanner)->RangeMultiplier(8)->Range(1, 4096);
+
+static void Script_Scanner_Untouched(benchmark::State& state) {
+  // Mostly plain script content, as in long multi-line scripts with a few placeholders.
+  std::string script{};
+  for (int64_t line{0}; line < state.range(0); ++line) {
+    script.append("echo \"some untouched script content, 100% without any placeholder\"\n");
+  }
+  script.append("%{target}");
+
+  for (auto _ : state) {
+    Litr::Script::Scanner scanner{script.c_str()};
+    for (Litr::Script::Token token{scanner.scan_token()};
+         token.type != Litr::Script::TokenType::EOS;
+         token = scanner.scan_token()) {
+      benchmark::DoNotOptimize(token);
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(script.size()));
+}
+BENCHMARK(Script_Scanner_Untouched)->RangeMultiplier(8)->Range(1, 4096);
+
+static void Script_Compiler(benchmark::State& state) {
+  const std::string script{create_script(state.range(0))};
+  const Litr::Script::Compiler::Variables variables{create_variables()};
+  const Litr::Config::Location location{1, 1, script};
+
+  for (auto _ : state) {
+    const Litr::Script::Compiler compiler{script, location, variables};
+    benchmark::DoNotOptimize(compiler.get_script());
+  }
+
+  Litr::Error::Handler::flush();
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(script.size()));
+}
+BENCHMARK(Script_Compiler)->RangeMultiplier(8)->Range(1, 4096);
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Config.hpp"
+
+#include <fmt/format.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+
+#include "Core/Utils.hpp"
+
+/** @private */
+static std::string create_script_line(const ConfigShape& shape, size_t line) {
+  constexpr size_t words{8};
+  const auto placeholders{static_cast<size_t>(
+      std::lround(shape.placeholder_density * static_cast<double>(words)))};
+
+  std::string script{"echo"};
+  for (size_t word{0}; word < words; ++word) {
+    if (word < placeholders && shape.params > 0) {
+      // Even parameters are strings, odd ones booleans.
+      const size_t param{(line + word) % shape.params};
+      script.append(param % 2 == 0 ? fmt::format(" %{{param-{}}}", param)
+                                   : fmt::format(" %{{param-{} 'flag-{}'}}", param, param));
+    } else {
+      script.append(fmt::format(" word-{}", word));
+    }
+  }
+
+  return script;
+}
+
+/** @private */
+static std::string create_scripts(const ConfigShape& shape) {
+  std::string scripts{"script = ["};
+
+  for (size_t line{0}; line < shape.script_lines; ++line) {
+    scripts.append(fmt::format("{}\"{}\"", line > 0 ? ", " : "", create_script_line(shape, line)));
+  }
+
+  return scripts.append("]");
+}
+
+/** @private */
+static std::string create_params(const ConfigShape& shape) {
+  std::string params{};
+
+  for (size_t param{0}; param < shape.params; ++param) {
+    if (param % 2 == 0) {
+      params.append(fmt::format(R"(
+[params.param-{0}]
+description = "String parameter number {0}."
+default = "value-{0}"
+)",
+          param));
+    } else {
+      params.append(fmt::format(R"(
+[params.param-{0}]
+description = "Boolean parameter number {0}."
+type = "boolean"
+)",
+          param));
+    }
+  }
+
+  return params;
+}
+
+std::string create_config(const ConfigShape& shape) {
+  const std::string scripts{create_scripts(shape)};
+  std::string config{R"([commands]
+noop = ":"
+)"};
+
+  for (size_t command{0}; command < shape.commands; ++command) {
+    std::string path{fmt::format("command-{}", command)};
+    config.append(
+        fmt::format("\n[commands.{}]\n{}\ndescription = \"Command number {}.\"\n",
+            path,
+            scripts,
+            command));
+
+    for (size_t level{1}; level < shape.depth; ++level) {
+      path.append(fmt::format(".level-{}", level));
+      config.append(fmt::format("\n[commands.{}]\n{}\n", path, scripts));
+    }
+  }
+
+  return config.append(create_params(shape));
+}
+
+bool apply_shape_argument(const std::string& argument, ConfigShape& shape) {
+  const size_t separator{argument.find('=')};
+  if (argument.rfind("--", 0) != 0 || separator == std::string::npos) {
+    return false;
+  }
+
+  const std::string name{argument.substr(2, separator - 2)};
+  const std::string value{argument.substr(separator + 1)};
+
+  if (name == "density") {
+    char* end{nullptr};
+    const double density{std::strtod(value.c_str(), &end)};
+    if (end == value.c_str() || *end != '\0' || density < 0 || density > 1) {
+      return false;
+    }
+    shape.placeholder_density = density;
+    return true;
+  }
+
+  const std::optional<size_t> number{Litr::Utils::parse_number<size_t>(value)};
+  if (!number.has_value()) {
+    return false;
+  }
+
+  if (name == "commands") {
+    shape.commands = *number;
+  } else if (name == "depth") {
+    shape.depth = *number;
+  } else if (name == "params") {
+    shape.params = *number;
+  } else if (name == "script-lines") {
+    shape.script_lines = *number;
+  } else {
+    return false;
+  }
+
+  return true;
+}
+
+std::string get_deepest_command(const ConfigShape& shape) {
+  if (shape.commands == 0) {
+    return "noop";
+  }
+
+  std::string command{fmt::format("command-{}", shape.commands - 1)};
+  for (size_t level{1}; level < shape.depth; ++level) {
+    command.append(fmt::format(" level-{}", level));
+  }
+
+  return command;
+}
+
+Litr::Path write_config(const std::string& name, const std::string& config) {
+  const std::filesystem::path path{
+      std::filesystem::temp_directory_path() / fmt::format("litr-benchmark-{}.toml", name)};
+
+  std::ofstream file{path, std::ios::binary | std::ios::trunc};
+  file << config;
+
+  return Litr::Path{path.string()};
+}
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <string>
+
+#include "Core/FileSystem.hpp"
+
+// Shape of a generated configuration. Every top level command gets a chain of
+// nested child commands `level-1 level-2 ...` up to the given depth.
+struct ConfigShape {
+  size_t commands{10};
+  size_t depth{1};
+  size_t params{2};
+  size_t script_lines{2};
+  // Share of script words being a `%{...}` placeholder, from 0 to 1.
+  double placeholder_density{0.25};
+};
+
+// Creates a configuration of the given shape. Besides the generated commands there
+// always is a `noop` command doing nothing, e.g. to measure the startup of Litr.
+std::string create_config(const ConfigShape& shape);
+
+// Applies a command line argument like `--commands=1000` to the shape. Returns false
+// for unknown arguments or invalid values.
+bool apply_shape_argument(const std::string& argument, ConfigShape& shape);
+
+// Creates the command line arguments to call the deepest nested command.
+std::string get_deepest_command(const ConfigShape& shape);
+
+// Writes the configuration as file into the temporary directory.
+Litr::Path write_config(const std::string& name, const std::string& config);
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include <fmt/format.h>
+
+#include <string>
+#include <vector>
+
+#include "Helpers/Config.hpp"
+
+// Prints a generated configuration file, e.g.:
+// ConfigGenerator --commands=1000 --depth=4 --params=8 --script-lines=3 --density=0.5 > litr.toml
+int main(int argc, char* argv[]) {
+  const std::vector<std::string> arguments(argv + 1, argv + argc);
+  ConfigShape shape{};
+
+  for (auto&& argument : arguments) {
+    if (!apply_shape_argument(argument, shape)) {
+      fmt::print(stderr,
+          "Invalid argument \"{}\".\n"
+          "Usage: ConfigGenerator [--commands=<n>] [--depth=<n>] [--params=<n>] "
+          "[--script-lines=<n>] [--density=<0..1>]\n",
+          argument);
+      return 1;
+    }
+  }
+
+  fmt::print("{}", create_config(shape));
+  return 0;
+}
@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include <fcntl.h>
+#include <fmt/format.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Core/Utils.hpp"
+#include "Helpers/Config.hpp"
+
+// Measures the startup of a Litr executable end to end against generated configurations
+// of growing size, to see where the cost of startup goes nonlinear, e.g.:
+// StartupBenchmark ./build/release/src/client/Client --sizes=10,1000,10000 --json=startup.json
+
+/** @private */
+struct Sample {
+  double milliseconds{0};
+  long peak_rss_kilobytes{0};
+  bool success{false};
+};
+
+/** @private */
+struct Result {
+  size_t commands{0};
+  std::string scenario{};
+  Sample cold{};
+  double warm_median{0};
+  double warm_min{0};
+  long peak_rss_kilobytes{0};
+  bool success{true};
+};
+
+/** @private */
+struct Scenario {
+  std::string name;
+  std::vector<std::string> arguments;
+};
+
+/** @private */
+static void evict_from_page_cache(const std::string& path) {
+#ifdef POSIX_FADV_DONTNEED
+  // Only evicts the file itself, shared libraries stay cached. Without root privileges
+  // this is the closest to a cold start that can be done.
+  const int file_descriptor{open(path.c_str(), O_RDONLY)};  // NOLINT
+  if (file_descriptor == -1) {
+    return;
+  }
+  fdatasync(file_descriptor);
+  posix_fadvise(file_descriptor, 0, 0, POSIX_FADV_DONTNEED);
+  close(file_descriptor);
+#else
+  static_cast<void>(path);
+#endif
+}
+
+/** @private */
+static Sample run(const std::string& litr,
+    const std::filesystem::path& directory,
+    const std::vector<std::string>& arguments) {
+  std::vector<char*> argv{};
+  argv.push_back(const_cast<char*>(litr.c_str()));  // NOLINT
+  for (auto&& argument : arguments) {
+    argv.push_back(const_cast<char*>(argument.c_str()));  // NOLINT
+  }
+  argv.push_back(nullptr);
+
+  const auto start{std::chrono::steady_clock::now()};
+  const pid_t pid{fork()};
+
+  if (pid == 0) {
+    const int null{open("/dev/null", O_WRONLY)};  // NOLINT
+    if (chdir(directory.c_str()) != 0 || null == -1) {
+      _exit(EXIT_FAILURE);
+    }
+    dup2(null, STDOUT_FILENO);
+    dup2(null, STDERR_FILENO);
+    execv(litr.c_str(), argv.data());
+    _exit(EXIT_FAILURE);
+  }
+
+  Sample sample{};
+  if (pid == -1) {
+    return sample;
+  }
+
+  int status{0};
+  rusage usage{};
+  wait4(pid, &status, 0, &usage);
+
+  const std::chrono::duration<double, std::milli> duration{
+      std::chrono::steady_clock::now() - start};
+  sample.milliseconds = duration.count();
+  sample.success = WIFEXITED(status) && WEXITSTATUS(status) == 0;  // NOLINT
+#ifdef LITR_PLATFORM_MACOS
+  // macOS reports the maximum resident set size in bytes instead of kilobytes.
+  sample.peak_rss_kilobytes = usage.ru_maxrss / 1024;
+#else
+  sample.peak_rss_kilobytes = usage.ru_maxrss;
+#endif
+
+  return sample;
+}
+
+/** @private */
+static Result measure(const std::string& litr,
+    const std::filesystem::path& directory,
+    const Scenario& scenario,
+    size_t runs) {
+  Result result{};
+  result.scenario = scenario.name;
+
+  evict_from_page_cache(litr);
+  evict_from_page_cache((directory / "litr.toml").string());
+  result.cold = run(litr, directory, scenario.arguments);
+  result.success = result.cold.success;
+
+  std::vector<double> samples{};
+  for (size_t index{0}; index < runs; ++index) {
+    const Sample sample{run(litr, directory, scenario.arguments)};
+    samples.push_back(sample.milliseconds);
+    result.peak_rss_kilobytes = std::max(result.peak_rss_kilobytes, sample.peak_rss_kilobytes);
+    result.success = result.success && sample.success;
+  }
+
+  std::sort(samples.begin(), samples.end());
+  if (!samples.empty()) {
+    result.warm_median = samples[samples.size() / 2];
+    result.warm_min = samples.front();
+  }
+
+  return result;
+}
+
+/** @private */
+static bool parse_sizes(const std::string& value, std::vector<size_t>& sizes) {
+  sizes.clear();
+  std::istringstream stream{value};
+  std::string size{};
+
+  while (std::getline(stream, size, ',')) {
+    const std::optional<size_t> number{Litr::Utils::parse_number<size_t>(size)};
+    if (!number.has_value()) {
+      return false;
+    }
+    sizes.push_back(*number);
+  }
+
+  return !sizes.empty();
+}
+
+/** @private */
+static void print_results(const std::vector<Result>& results) {
+  fmt::print("{:>9}  {:<8}  {:>11}  {:>12}  {:>11}  {:>10}  {:>7}\n",
+      "commands",
+      "scenario",
+      "cold",
+      "warm median",
+      "warm min",
+      "peak RSS",
+      "growth");
+
+  for (auto&& result : results) {
+    // Growth of the warm median compared to the same scenario with the previous size.
+    std::string growth{"-"};
+    const auto previous{std::find_if(results.rbegin(), results.rend(), [&result](auto&& other) {
+      return other.scenario == result.scenario && other.commands < result.commands;
+    })};
+    if (previous != results.rend() && previous->warm_median > 0) {
+      growth = fmt::format("x{:.2f}", result.warm_median / previous->warm_median);
+    }
+
+    fmt::print("{:>9}  {:<8}  {:>8.2f} ms  {:>9.2f} ms  {:>8.2f} ms  {:>7.1f} MB  {:>7}{}\n",
+        result.commands,
+        result.scenario,
+        result.cold.milliseconds,
+        result.warm_median,
+        result.warm_min,
+        static_cast<double>(result.peak_rss_kilobytes) / 1024.0,
+        growth,
+        result.success ? "" : "  (failed)");
+  }
+}
+
+/** @private */
+static void write_json(const std::string& path, const std::vector<Result>& results) {
+  std::ofstream file{path, std::ios::trunc};
+  file << "[\n";
+
+  for (size_t index{0}; index < results.size(); ++index) {
+    const Result& result{results[index]};
+    file << fmt::format(
+        R"(  {{"commands": {}, "scenario": "{}", "cold_ms": {:.3f}, "warm_median_ms": {:.3f}, )"
+        R"("warm_min_ms": {:.3f}, "peak_rss_kb": {}, "success": {}}}{})",
+        result.commands,
+        result.scenario,
+        result.cold.milliseconds,
+        result.warm_median,
+        result.warm_min,
+        result.peak_rss_kilobytes,
+        result.success,
+        index + 1 < results.size() ? ",\n" : "\n");
+  }
+
+  file << "]\n";
+}
+
+int main(int argc, char* argv[]) {
+  const std::vector<std::string> arguments(argv + 1, argv + argc);
+  if (arguments.empty()) {
+    fmt::print(stderr,
+        "Usage: StartupBenchmark <litr-executable> [--runs=<n>] [--sizes=<n,n,...>] "
+        "[--json=<file>] [--depth=<n>] [--params=<n>] [--script-lines=<n>] "
+        "[--density=<0..1>]\n");
+    return 1;
+  }
+
+  const std::string litr{std::filesystem::absolute(arguments.front()).string()};
+  std::vector<size_t> sizes{10, 100, 1000, 10000};
+  size_t runs{10};
+  std::string json{};
+
+  ConfigShape shape{};
+  shape.depth = 4;
+  shape.params = 8;
+
+  for (auto argument{arguments.begin() + 1}; argument != arguments.end(); ++argument) {
+    bool valid{true};
+    if (argument->rfind("--sizes=", 0) == 0) {
+      valid = parse_sizes(argument->substr(8), sizes);
+    } else if (argument->rfind("--runs=", 0) == 0) {
+      runs = Litr::Utils::parse_number<size_t>(argument->substr(7)).value_or(0);
+      valid = runs > 0;
+    } else if (argument->rfind("--json=", 0) == 0) {
+      json = argument->substr(7);
+    } else {
+      valid = apply_shape_argument(*argument, shape);
+    }
+
+    if (!valid) {
+      fmt::print(stderr, "Invalid argument \"{}\".\n", *argument);
+      return 1;
+    }
+  }
+
+  std::vector<Result> results{};
+
+  for (auto&& size : sizes) {
+    shape.commands = size;
+
+    const std::filesystem::path directory{
+        std::filesystem::temp_directory_path() / fmt::format("litr-startup-{}", size)};
+    std::filesystem::create_directories(directory);
+    std::ofstream{directory / "litr.toml", std::ios::binary | std::ios::trunc}
+        << create_config(shape);
+
+    std::vector<std::string> nested{};
+    std::istringstream command{get_deepest_command(shape)};
+    for (std::string part{}; command >> part;) {
+      nested.push_back(part);
+    }
+
+    const std::vector<Scenario> scenarios{
+        {"help", {"--help"}}, {"noop", {"noop"}}, {"nested", nested}};
+    for (auto&& scenario : scenarios) {
+      Result result{measure(litr, directory, scenario, runs)};
+      result.commands = size;
+      results.push_back(result);
+    }
+  }
+
+  print_results(results);
+
+  if (!json.empty()) {
+    write_json(json, results);
+  }
+
+  return 0;
+}
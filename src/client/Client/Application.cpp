@@ -8,6 +8,9 @@
 #include <fmt/format.h>
 
 #include <memory>
+#include <optional>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "Hooks/Handler.hpp"
@@ -19,9 +22,8 @@ namespace Litr {
 ExitStatus Application::run(const std::vector<std::string>& arguments) {
   LITR_PROFILE_FUNCTION();
 
-  const std::string source{source_from_arguments(arguments)};
   const auto instruction{std::make_shared<CLI::Instruction>()};
-  const CLI::Parser parser{instruction, source};
+  const CLI::Parser parser{instruction, arguments};
 
   // Litr called without any arguments:
   if (instruction->count() == 0) {
@@ -37,6 +39,22 @@ ExitStatus Application::run(const std::vector<std::string>& arguments) {
     return ExitStatus::SUCCESS;
   }
 
+  const CLI::Options options{instruction};
+
+  // Scripts only read the timeout once they run, a wrong one is reported before anything does.
+  if (options.has("timeout") && !Utils::parse_duration(options.get("timeout")).has_value()) {
+    Error::Handler::push(Error::CommandNotFoundError(
+        "The option --timeout needs a duration, e.g. `--timeout=15m`."));
+    Error::Reporter error_reporter{Path{}};
+    error_reporter.print_errors(Error::Handler::get_errors());
+    return ExitStatus::FAILURE;
+  }
+
+  // A workspace has a configuration per package, there is no single one to load.
+  if (options.has("workspace")) {
+    return run_workspace(instruction, options);
+  }
+
   const Path config_path{get_config_path()};
   if (m_exit_status == ExitStatus::FAILURE) {
     return m_exit_status;
@@ -48,7 +66,15 @@ ExitStatus Application::run(const std::vector<std::string>& arguments) {
     return ExitStatus::FAILURE;
   }
 
-  const auto config{std::make_shared<Config::Loader>(config_path)};
+  // Commands are only built once used, unless the whole configuration should be validated.
+  const bool validate{options.has("validate")};
+  const auto config{std::make_shared<Config::Loader>(
+      config_path, validate ? Config::Loader::Mode::EAGER : Config::Loader::Mode::LAZY)};
+  if (validate && Error::Handler::has_errors()) {
+    error_reporter.print_errors(Error::Handler::get_errors());
+    return ExitStatus::FAILURE;
+  }
+
   const auto interpreter{std::make_shared<CLI::Interpreter>(instruction, config)};
 
   hooks.add(CLI::Instruction::Code::DEFINE,
@@ -62,9 +88,23 @@ ExitStatus Application::run(const std::vector<std::string>& arguments) {
   }
 
   // Run
-  interpreter->execute();
+  bool can_resume{false};
+  if (options.has("watch")) {
+    CLI::Watch watch{instruction,
+        config,
+        validate ? Config::Loader::Mode::EAGER : Config::Loader::Mode::LAZY};
+    watch.run();
+  } else if (options.has("bench")) {
+    run_benchmark(instruction, interpreter, options);
+  } else {
+    can_resume = run_journaled(instruction, interpreter, config, options);
+  }
+
   if (Error::Handler::has_errors()) {
     error_reporter.print_errors(Error::Handler::get_errors());
+    if (can_resume) {
+      fmt::print("Run the same again with `--resume` to skip the scripts already done.\n");
+    }
     return ExitStatus::FAILURE;
   }
 
@@ -100,27 +140,112 @@ Path Application::get_config_path() {
   return config_path.get_file_path();
 }
 
-std::string Application::source_from_arguments(const std::vector<std::string>& arguments) {
+void Application::run_benchmark(const std::shared_ptr<CLI::Instruction>& instruction,
+    const std::shared_ptr<CLI::Interpreter>& interpreter,
+    const CLI::Options& options) {
   LITR_PROFILE_FUNCTION();
 
-  std::string source{};
+  const size_t runs{get_run_count(options, "bench")};
+  const size_t warmup{options.has("warmup") ? get_run_count(options, "warmup", true) : 0};
+  if (Error::Handler::has_errors()) {
+    return;
+  }
 
-  // !!! HACK ALERT START !!!
-  // @todo: https://github.com/krieselreihe/litr/issues/20
-  for (std::string argument : arguments) {
-    std::size_t found{argument.find('=')};
+  CLI::Benchmark benchmark{instruction, interpreter};
+  benchmark.run(runs, warmup);
+  if (Error::Handler::has_errors()) {
+    return;
+  }
 
-    if (found != std::string::npos) {
-      std::vector<std::string> parts{};
-      Utils::split_into(argument, '=', parts);
-      argument = parts[0].append("=\"").append(parts[1]).append("\"");
-    }
+  benchmark.print_results();
+}
+
+bool Application::run_journaled(const std::shared_ptr<CLI::Instruction>& instruction,
+    const std::shared_ptr<CLI::Interpreter>& interpreter,
+    const std::shared_ptr<Config::Loader>& config,
+    const CLI::Options& options) {
+  LITR_PROFILE_FUNCTION();
+
+  const auto journal{std::make_shared<CLI::Journal>(instruction, config, options.has("resume"))};
+  interpreter->set_journal(journal);
+  interpreter->execute();
+
+  if (!Error::Handler::has_errors()) {
+    journal->remove();
+    return false;
+  }
+
+  return journal->has_steps();
+}
+
+ExitStatus Application::run_workspace(
+    const std::shared_ptr<CLI::Instruction>& instruction, const CLI::Options& options) {
+  LITR_PROFILE_FUNCTION();
+
+  // Without a limit every core runs a package, `auto` or a range adapts to the load.
+  const std::string jobs{options.get("jobs")};
+  const bool is_adaptive{jobs == "auto" || jobs.find('-') != std::string::npos};
+  size_t min_jobs{ThreadPool::get_default_size() + 1};
+  size_t max_jobs{min_jobs};
+  if (is_adaptive) {
+    std::tie(min_jobs, max_jobs) = get_job_range(jobs);
+  } else if (options.has("jobs")) {
+    max_jobs = get_run_count(options, "jobs");
+  }
+  if (Error::Handler::has_errors()) {
+    Error::Reporter error_reporter{Path{}};
+    error_reporter.print_errors(Error::Handler::get_errors());
+    return ExitStatus::FAILURE;
+  }
+
+  const Path root{CLI::Workspace::find_root(FileSystem::get_current_working_directory())};
+  CLI::Workspace workspace{instruction, root};
+  if (workspace.get_packages().empty()) {
+    fmt::print(fg(fmt::color::crimson), "No configuration file found in {}!\n", root);
+    return ExitStatus::FAILURE;
+  }
+
+  if (is_adaptive) {
+    workspace.run_adaptive(min_jobs, max_jobs);
+  } else {
+    workspace.run(max_jobs);
+  }
+  workspace.print_summary();
+
+  return workspace.has_failures() ? ExitStatus::FAILURE : ExitStatus::SUCCESS;
+}
+
+size_t Application::get_run_count(
+    const CLI::Options& options, const std::string& name, bool allow_zero) {
+  LITR_PROFILE_FUNCTION();
+
+  const std::optional<size_t> count{Utils::parse_number<size_t>(options.get(name))};
+  if (count.has_value() && (*count > 0 || allow_zero)) {
+    return *count;
+  }
+
+  Error::Handler::push(Error::CommandNotFoundError(
+      fmt::format("The option --{} needs a number, e.g. `--{}=10`.", name, name)));
+  return 0;
+}
+
+std::pair<size_t, size_t> Application::get_job_range(const std::string& value) {
+  LITR_PROFILE_FUNCTION();
+
+  if (value == "auto") {
+    return {1, ThreadPool::get_default_size() + 1};
+  }
 
-    source.append(" ").append(argument);
+  const size_t separator{value.find('-')};
+  const std::optional<size_t> min_jobs{Utils::parse_number<size_t>(value.substr(0, separator))};
+  const std::optional<size_t> max_jobs{Utils::parse_number<size_t>(value.substr(separator + 1))};
+  if (min_jobs.has_value() && max_jobs.has_value() && *min_jobs > 0 && *min_jobs <= *max_jobs) {
+    return {*min_jobs, *max_jobs};
   }
-  // !!! HACK ALERT END !!!
 
-  return source;
+  Error::Handler::push(Error::CommandNotFoundError(
+      "The option --jobs needs a range from low to high, e.g. `--jobs=2-8`, or `auto`."));
+  return {0, 0};
 }
 
 }  // namespace Litr
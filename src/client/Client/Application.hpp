@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 
 #include "Core.hpp"
 
@@ -17,7 +20,20 @@ class Application {
 
  private:
   [[nodiscard]] Path get_config_path();
-  [[nodiscard]] static std::string source_from_arguments(const std::vector<std::string>& arguments);
+  static void run_benchmark(const std::shared_ptr<CLI::Instruction>& instruction,
+      const std::shared_ptr<CLI::Interpreter>& interpreter,
+      const CLI::Options& options);
+  // Tells if a failed run can be resumed.
+  [[nodiscard]] static bool run_journaled(const std::shared_ptr<CLI::Instruction>& instruction,
+      const std::shared_ptr<CLI::Interpreter>& interpreter,
+      const std::shared_ptr<Config::Loader>& config,
+      const CLI::Options& options);
+  [[nodiscard]] static ExitStatus run_workspace(
+      const std::shared_ptr<CLI::Instruction>& instruction, const CLI::Options& options);
+  [[nodiscard]] static size_t get_run_count(
+      const CLI::Options& options, const std::string& name, bool allow_zero = false);
+  // The lowest and highest number of packages for `--jobs=auto` or `--jobs=<min>-<max>`.
+  [[nodiscard]] static std::pair<size_t, size_t> get_job_range(const std::string& value);
 
   ExitStatus m_exit_status{ExitStatus::SUCCESS};
 };
@@ -18,6 +18,7 @@ int main(int argc, char* argv[]) {
   Litr::ExitStatus status{app.run(arguments)};
 
   LITR_PROFILE_END_SESSION();
+  LITR_ALLOCATION_SUMMARY();
 
   return static_cast<int>(status);
 }
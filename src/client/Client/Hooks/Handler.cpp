@@ -24,22 +24,18 @@ bool Handler::execute() const {
   size_t offset{0};
 
   while (offset < m_instruction->count()) {
-    const Code code{m_instruction->read(offset++)};
+    const auto code{static_cast<Code>(m_instruction->read(offset++))};
+    if (code == Code::CLEAR) {
+      continue;
+    }
 
+    const Value value{m_instruction->read_constant(m_instruction->read_operand(offset))};
     for (auto&& hook : m_hooks) {
-      if (code != hook.code) {
-        continue;
-      }
-      auto value{m_instruction->read_constant(m_instruction->read(offset))};
-      if (value == hook.value) {
+      if (code == hook.code && value == hook.value) {
         hook.callback(m_instruction);
         return true;
       }
     }
-
-    if (code != Code::CLEAR) {
-      ++offset;
-    }
   }
 
   return false;
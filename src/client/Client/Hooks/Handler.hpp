@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -19,12 +20,12 @@ class Handler {
 
   struct Hook {
     CLI::Instruction::Code code;
-    CLI::Instruction::Value value;
+    std::string value;
     HookCallback callback;
 
     Hook(CLI::Instruction::Code code, CLI::Instruction::Value value, HookCallback callback)
         : code(code),
-          value(std::move(value)),
+          value(value),
           callback(std::move(callback)) {}
   };
 
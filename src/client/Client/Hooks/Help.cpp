@@ -9,6 +9,7 @@
 #include <fmt/printf.h>
 
 #include <algorithm>
+#include <string_view>
 #include <vector>
 
 namespace Litr::Hook {
@@ -60,9 +61,9 @@ void Help::print_command_usage() const {
   std::replace(command_name.begin(), command_name.end(), '.', ' ');
   fmt::print("Usage: litr {} [options]", command_name);
 
-  const std::string description{m_query.get_command(m_command_name)->description};
+  const std::string_view description{m_query.get_command(m_command_name)->description};
   if (!description.empty()) {
-    fmt::print("\n  {}", m_query.get_command(m_command_name)->description);
+    fmt::print("\n  {}", description);
   }
 
   fmt::print("\n\n");
@@ -87,44 +88,44 @@ void Help::print_commands() const {
 
 // Ignore recursion as this is needed to print nested commands.
 // NOLINTNEXTLINE(misc-no-recursion)
-void Help::print_command(const std::shared_ptr<Config::Command>& command,
+void Help::print_command(const Config::Command& command,
     const std::string& parent_name,
     size_t depth) const {
   size_t padding{get_command_padding()};
-  std::string command_path{command->name};
+  std::string command_path{command.name};
 
   if (!parent_name.empty()) {
     padding -= (depth - 1) * 2;  // Reduce right padding for short child commands.
-    command_path = fmt::format("{}.{}", parent_name, command->name);
+    command_path = fmt::format("{}.{}", parent_name, command.name);
   }
 
   const std::string arguments{get_command_arguments(command_path)};
   const std::string name{fmt::format("{: ^{}}{:<{}} {}",
       "",
       depth * 2,  // Left side padding
-      command->name,
+      command.name,
       padding,
       arguments)};
 
-  if (command->description.empty()) {
+  if (command.description.empty()) {
     fmt::print("{}\n", name);
   } else {
-    print_with_description(name, fmt::format("  {}", command->description), arguments.length());
+    print_with_description(name, fmt::format("  {}", command.description), arguments.length());
   }
 
   print_example(command);
 
-  for (auto&& child_command : command->child_commands) {
+  for (auto&& child_command : command.child_commands) {
     print_command(child_command, command_path, depth + 1);
   }
 }
 
-void Help::print_example(const std::shared_ptr<Config::Command>& command) const {
-  if (!command->example.empty()) {
+void Help::print_example(const Config::Command& command) const {
+  if (!command.example.empty()) {
     const size_t padding{get_parameter_padding()};
 
     std::vector<std::string> lines{};
-    Utils::split_into(command->example, '\n', lines);
+    Utils::split_into(std::string{command.example}, '\n', lines);
 
     fmt::print(fg(fmt::color::dark_gray), "{:<{}}   ┌ Example(s):\n", " ", padding);
     for (auto&& line : lines) {
@@ -148,6 +149,11 @@ void Help::print_options() const {
   fmt::print("  {:<{}} {}\n", "-h --help", padding, "Show this screen.");
   fmt::print("  {:<{}} {}\n", "-v --version", padding, "Show current Litr version.");
 
+  for (auto&& option : CLI::Options::get_definitions()) {
+    const std::string name{fmt::format("   --{}{}", option.name, option.argument)};
+    fmt::print("  {:<{}} {}\n", name, padding, option.description);
+  }
+
   for (auto&& param : params) {
     std::string name{};
     const std::string argument{param->type_arguments.empty() ? "" : m_argument_placeholder};
@@ -230,13 +236,11 @@ std::string Help::get_command_name(const std::shared_ptr<CLI::Instruction>& inst
   std::vector<std::string> scope{};
 
   while (offset < instruction->count()) {
-    const CLI::Instruction::Code code{instruction->read(offset++)};
+    const auto code{static_cast<CLI::Instruction::Code>(instruction->read(offset++))};
 
     switch (code) {
       case CLI::Instruction::Code::BEGIN_SCOPE: {
-        const std::string value{instruction->read_constant(instruction->read(offset))};
-        scope.push_back(value);
-        ++offset;
+        scope.emplace_back(instruction->read_constant(instruction->read_operand(offset)));
         break;
       }
       case CLI::Instruction::Code::CLEAR: {
@@ -244,20 +248,20 @@ std::string Help::get_command_name(const std::shared_ptr<CLI::Instruction>& inst
         break;
       }
       case CLI::Instruction::Code::DEFINE: {
-        const std::string value{instruction->read_constant(instruction->read(offset))};
+        const CLI::Instruction::Value value{
+            instruction->read_constant(instruction->read_operand(offset))};
         if (value == "h" || value == "help") {
           std::string command_name{};
           for (auto&& part : scope) {
             command_name.append(".").append(part);
           }
-          return Utils::trim_left(command_name, '.');
+          return std::string{Utils::trim_left(command_name, '.')};
         }
-        ++offset;
         break;
       }
       case CLI::Instruction::Code::CONSTANT:
       case CLI::Instruction::Code::EXECUTE: {
-        ++offset;
+        static_cast<void>(instruction->read_operand(offset));
         break;
       }
     }
@@ -307,20 +311,20 @@ size_t Help::get_command_padding() const {
 
 // Ignore recursion as this is needed to get padding for nested commands.
 // NOLINTNEXTLINE(misc-no-recursion)
-size_t Help::get_command_padding(const Config::Query::Commands& commands) const {
+size_t Help::get_command_padding(Config::Query::Commands commands) const {
   LITR_PROFILE_FUNCTION();
 
   size_t padding{0};
 
   for (auto&& command : commands) {
-    const size_t command_length{command->name.length()};
+    const size_t command_length{command.name.length()};
 
     if (padding < command_length) {
       padding = command_length;
     }
 
     // Add 2 for child command padding alignment. It's a hack, I know ¯\_(ツ)_/¯
-    const size_t child_padding{get_command_padding(command->child_commands) + 2};
+    const size_t child_padding{get_command_padding(command.child_commands) + 2};
 
     if (padding < child_padding) {
       padding = child_padding;
@@ -350,6 +354,15 @@ size_t Help::get_parameter_padding() const {
     }
   }
 
+  for (auto&& option : CLI::Options::get_definitions()) {
+    const size_t option_length{std::string(option.name).length() +
+                               std::string(option.argument).length()};
+
+    if (padding < option_length) {
+      padding = option_length;
+    }
+  }
+
   if (padding < min_padding) {
     padding = min_padding;
   }
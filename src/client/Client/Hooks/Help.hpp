@@ -22,11 +22,11 @@ class Help {
   void print_command_usage() const;
 
   void print_commands() const;
-  void print_command(const std::shared_ptr<Config::Command>& command,
+  void print_command(const Config::Command& command,
       const std::string& parent_name,
       size_t depth = 1) const;
 
-  void print_example(const std::shared_ptr<Config::Command>& command) const;
+  void print_example(const Config::Command& command) const;
   void print_options() const;
   void print_parameter_options(const std::shared_ptr<Config::Parameter>& param) const;
   void print_default_parameter_option(const std::shared_ptr<Config::Parameter>& param) const;
@@ -38,7 +38,7 @@ class Help {
   [[nodiscard]] std::string get_command_arguments(const std::string& name) const;
 
   [[nodiscard]] size_t get_command_padding() const;
-  [[nodiscard]] size_t get_command_padding(const Config::Query::Commands& commands) const;
+  [[nodiscard]] size_t get_command_padding(Config::Query::Commands commands) const;
   [[nodiscard]] size_t get_parameter_padding() const;
 
   [[nodiscard]] static bool sort_parameter_by_required(
@@ -6,37 +6,67 @@
 
 // Base -------------------------------
 
+#include "Core/Arena.hpp"
 #include "Core/Assert.hpp"
 #include "Core/ExitStatus.hpp"
 #include "Core/Log.hpp"
+#include "Core/Span.hpp"
+#include "Core/StringPool.hpp"
+#include "Core/ThreadPool.hpp"
 #include "Core/Utils.hpp"
 #include "Version.hpp"
 
 // Main -------------------------------
 
+#include "Core/AppendFile.hpp"
+#include "Core/DirectoryWalker.hpp"
 #include "Core/Environment.hpp"
+#include "Core/FileLock.hpp"
 #include "Core/FileSystem.hpp"
+#include "Core/FileWatcher.hpp"
+#include "Core/GitIgnore.hpp"
+#include "Core/MappedFile.hpp"
+#include "Core/Process.hpp"
+#include "Core/ProcessTracer.hpp"
+#include "Core/SystemLoad.hpp"
 
 // Config -----------------------------
 
 #include "Core/Config/Command.hpp"
+#include "Core/Config/CommandTable.hpp"
 #include "Core/Config/FileAdapter.hpp"
 #include "Core/Config/FileResolver.hpp"
 #include "Core/Config/Loader.hpp"
 #include "Core/Config/Location.hpp"
+#include "Core/Config/MappedFileAdapter.hpp"
 #include "Core/Config/Parameter.hpp"
 #include "Core/Config/Query.hpp"
+#include "Core/Config/Settings.hpp"
 #include "Core/Config/TomlFileAdapter.hpp"
+#include "Core/Config/TomlReader.hpp"
+#include "Core/Config/Value.hpp"
 
 // CLI --------------------------------
 
+#include "Core/CLI/Benchmark.hpp"
+#include "Core/CLI/Changes.hpp"
+#include "Core/CLI/CommandLock.hpp"
 #include "Core/CLI/Instruction.hpp"
 #include "Core/CLI/Interpreter.hpp"
+#include "Core/CLI/Journal.hpp"
+#include "Core/CLI/Options.hpp"
+#include "Core/CLI/OutputCache.hpp"
 #include "Core/CLI/Parser.hpp"
+#include "Core/CLI/Resources.hpp"
+#include "Core/CLI/ResultFile.hpp"
 #include "Core/CLI/Scanner.hpp"
 #include "Core/CLI/Shell.hpp"
+#include "Core/CLI/Throttle.hpp"
 #include "Core/CLI/Token.hpp"
+#include "Core/CLI/TracedInputs.hpp"
 #include "Core/CLI/Variable.hpp"
+#include "Core/CLI/Watch.hpp"
+#include "Core/CLI/Workspace.hpp"
 
 // Script -----------------------------
 
@@ -52,5 +82,8 @@
 
 // Debug ------------------------------
 
+#include "Core/Debug/AllocationTracker.hpp"
+#include "Core/Debug/CpuTime.hpp"
 #include "Core/Debug/Disassembler.hpp"
 #include "Core/Debug/Instrumentor.hpp"
+#include "Core/Debug/PerfCounter.hpp"
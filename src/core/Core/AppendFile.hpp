@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <string_view>
+
+#include "Core/FileSystem.hpp"
+
+namespace Litr {
+
+// A file only ever written at its end. Every append is on the disk before it returns,
+// so it survives the process being killed right after, e.g. when running out of memory.
+class AppendFile {
+ public:
+  enum class Mode { KEEP, TRUNCATE };
+
+  explicit AppendFile(const Path& path, Mode mode = Mode::KEEP);
+
+  // Neither copy nor move, the file belongs to this instance only.
+  AppendFile(const AppendFile&) = delete;
+  AppendFile(AppendFile&&) = delete;
+  AppendFile& operator=(const AppendFile&) = delete;
+  AppendFile& operator=(AppendFile&&) = delete;
+  ~AppendFile();
+
+  [[nodiscard]] inline bool is_open() const {
+    return m_file_descriptor != -1;
+  }
+
+  // Returns false if the data could not be written as a whole.
+  bool append(std::string_view data);
+
+ private:
+  int m_file_descriptor{-1};
+};
+
+}  // namespace Litr
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "Core/Span.hpp"
+
+namespace Litr {
+
+// Stores values in chunks that never move, so views on them stay valid for the
+// lifetime of the arena. Values are only freed all at once with the arena.
+template <typename T>
+class Arena {
+ public:
+  explicit Arena(size_t chunk_size = default_chunk_size) : m_chunk_size(chunk_size) {}
+
+  // Contiguous block of default constructed values.
+  [[nodiscard]] Span<T> allocate(size_t count) {
+    Chunk& chunk{get_chunk(count)};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    T* data{chunk.data.get() + chunk.size};
+    chunk.size += count;
+    return {data, count};
+  }
+
+  // Appends a value to a range, keeping the range contiguous. This is cheap as long as
+  // only one range at a time is growing, otherwise the range gets copied to the end first.
+  [[nodiscard]] Span<const T> append(Span<const T> range, T value) {
+    if (!m_chunks.empty()) {
+      Chunk& chunk{m_chunks.back()};
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      T* end{chunk.data.get() + chunk.size};
+      if ((range.empty() || range.end() == end) && chunk.size < chunk.capacity) {
+        *end = std::move(value);
+        ++chunk.size;
+        return {range.empty() ? end : range.data(), range.size() + 1};
+      }
+    }
+
+    const Span<T> block{allocate(std::max(range.size() + 1, range.size() * 2))};
+    std::copy(range.begin(), range.end(), block.begin());
+    block[range.size()] = std::move(value);
+    // Give back what is not needed yet, so the range can keep growing in place.
+    m_chunks.back().size -= block.size() - range.size() - 1;
+
+    return {block.data(), range.size() + 1};
+  }
+
+ private:
+  static constexpr size_t default_chunk_size{256};
+
+  struct Chunk {
+    std::unique_ptr<T[]> data;  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    size_t capacity;
+    size_t size;
+  };
+
+  [[nodiscard]] Chunk& get_chunk(size_t count) {
+    if (m_chunks.empty() || m_chunks.back().capacity - m_chunks.back().size < count) {
+      const size_t capacity{std::max(m_chunk_size, count)};
+      // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+      m_chunks.push_back({std::make_unique<T[]>(capacity), capacity, 0});
+    }
+
+    return m_chunks.back();
+  }
+
+  const size_t m_chunk_size;
+  std::vector<Chunk> m_chunks{};
+};
+
+}  // namespace Litr
@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Benchmark.hpp"
+
+#include <fmt/color.h>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <numeric>
+#include <utility>
+
+#include "Core/CLI/Options.hpp"
+#include "Core/Debug/CpuTime.hpp"
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/Error/Handler.hpp"
+
+namespace Litr::CLI {
+
+/** @private */
+static double get_quartile(const std::vector<Benchmark::Seconds>& sorted, double quartile) {
+  LITR_PROFILE_FUNCTION();
+
+  // Linear interpolation between the closest ranks.
+  const double position{quartile * static_cast<double>(sorted.size() - 1)};
+  const auto lower{static_cast<size_t>(std::floor(position))};
+  const auto upper{static_cast<size_t>(std::ceil(position))};
+  const double fraction{position - static_cast<double>(lower)};
+
+  return sorted[lower].count() + (sorted[upper].count() - sorted[lower].count()) * fraction;
+}
+
+/** @private */
+template <typename Measurement>
+static std::vector<Benchmark::Seconds> get_samples(const std::vector<Measurement>& measurements,
+    Benchmark::Seconds Measurement::*member) {
+  LITR_PROFILE_FUNCTION();
+
+  std::vector<Benchmark::Seconds> samples{};
+  samples.reserve(measurements.size());
+  for (auto&& measurement : measurements) {
+    samples.push_back(measurement.*member);
+  }
+  return samples;
+}
+
+Benchmark::Benchmark(
+    const std::shared_ptr<Instruction>& instruction, std::shared_ptr<Interpreter> interpreter)
+    : m_interpreter(std::move(interpreter)) {
+  LITR_PROFILE_FUNCTION();
+
+  for (auto&& label : get_labels(instruction)) {
+    m_subjects.emplace_back(label);
+  }
+}
+
+void Benchmark::run(size_t runs, size_t warmup) {
+  LITR_PROFILE_FUNCTION();
+
+  m_warmup = warmup;
+  m_interpreter->set_execution_hook(
+      [this](const Instruction::Value& /*name*/, const std::function<void()>& execute) {
+        measure(execute);
+      });
+
+  for (size_t run{0}; run < warmup + runs; ++run) {
+    m_record = run >= warmup;
+    m_current_subject = 0;
+
+    fmt::print(fg(fmt::color::dark_gray),
+        "\r{} {}/{}",
+        m_record ? "Measuring" : "Warming up",
+        m_record ? run - warmup + 1 : run + 1,
+        m_record ? runs : warmup);
+    std::fflush(stdout);
+
+    m_interpreter->execute();
+    if (Error::Handler::has_errors()) {
+      break;
+    }
+  }
+
+  m_interpreter->set_execution_hook(nullptr);
+  fmt::print("\r\033[K");
+}
+
+void Benchmark::measure(const std::function<void()>& execute) {
+  LITR_PROFILE_FUNCTION();
+
+  const Debug::CpuTime cpu_start{Debug::CpuTime::of_children()};
+  const auto start{std::chrono::steady_clock::now()};
+
+  execute();
+
+  const auto end{std::chrono::steady_clock::now()};
+  const Debug::CpuTime cpu{Debug::CpuTime::of_children() - cpu_start};
+
+  if (m_record && m_current_subject < m_subjects.size()) {
+    m_subjects[m_current_subject].measurements.push_back({end - start, cpu.user, cpu.system});
+  }
+
+  ++m_current_subject;
+}
+
+void Benchmark::print_results() const {
+  LITR_PROFILE_FUNCTION();
+
+  for (auto&& subject : m_subjects) {
+    print_subject(subject);
+  }
+
+  if (m_subjects.size() > 1) {
+    print_summary();
+  }
+}
+
+Benchmark::Statistics Benchmark::get_statistics(std::vector<Seconds> samples) {
+  LITR_PROFILE_FUNCTION();
+
+  Statistics statistics{};
+  if (samples.empty()) {
+    return statistics;
+  }
+
+  std::sort(samples.begin(), samples.end());
+
+  const auto count{static_cast<double>(samples.size())};
+  const Seconds sum{std::accumulate(samples.begin(), samples.end(), Seconds{0})};
+  statistics.mean = sum / count;
+  statistics.min = samples.front();
+  statistics.max = samples.back();
+  statistics.median = Seconds{get_quartile(samples, 0.5)};
+
+  if (samples.size() > 1) {
+    double squares{0};
+    for (auto&& sample : samples) {
+      const double difference{sample.count() - statistics.mean.count()};
+      squares += difference * difference;
+    }
+    statistics.standard_deviation = Seconds{std::sqrt(squares / (count - 1))};
+  }
+
+  // Tukey's fences, everything outside 1.5 times the interquartile range is an outlier.
+  constexpr double fence_factor{1.5};
+  const double lower_quartile{get_quartile(samples, 0.25)};
+  const double upper_quartile{get_quartile(samples, 0.75)};
+  const double fence{(upper_quartile - lower_quartile) * fence_factor};
+
+  statistics.outliers = static_cast<size_t>(
+      std::count_if(samples.begin(), samples.end(), [&](const Seconds& sample) {
+        return sample.count() < lower_quartile - fence || sample.count() > upper_quartile + fence;
+      }));
+
+  return statistics;
+}
+
+void Benchmark::print_subject(const Subject& subject) const {
+  LITR_PROFILE_FUNCTION();
+
+  const Statistics wall{get_statistics(get_samples(subject.measurements, &Measurement::wall))};
+  const Statistics user{get_statistics(get_samples(subject.measurements, &Measurement::user))};
+  const Statistics system{get_statistics(get_samples(subject.measurements, &Measurement::system))};
+
+  fmt::print(fmt::emphasis::bold, "Benchmark: {}\n", subject.label);
+  fmt::print("  Time (mean ± σ):     {} ± {}    [User: {}, System: {}]\n",
+      format_duration(wall.mean),
+      format_duration(wall.standard_deviation),
+      format_duration(user.mean),
+      format_duration(system.mean));
+  fmt::print("  Median:              {}\n", format_duration(wall.median));
+  fmt::print("  Range (min … max):   {} … {}    {} runs",
+      format_duration(wall.min),
+      format_duration(wall.max),
+      subject.measurements.size());
+
+  if (m_warmup > 0) {
+    fmt::print(", {} warmup", m_warmup);
+  }
+  fmt::print("\n");
+
+  if (wall.outliers > 0) {
+    fmt::print(fg(fmt::color::gold),
+        "  Warning: {} statistical outlier(s) detected. "
+        "Consider more warmup runs or a quieter system.\n",
+        wall.outliers);
+  }
+
+  fmt::print("\n");
+}
+
+void Benchmark::print_summary() const {
+  LITR_PROFILE_FUNCTION();
+
+  std::vector<std::pair<const Subject*, Statistics>> results{};
+  for (auto&& subject : m_subjects) {
+    results.emplace_back(
+        &subject, get_statistics(get_samples(subject.measurements, &Measurement::wall)));
+  }
+
+  const auto fastest{std::min_element(results.begin(), results.end(), [](auto&& a, auto&& b) {
+    return a.second.mean < b.second.mean;
+  })};
+
+  fmt::print(fmt::emphasis::bold, "Summary\n");
+  fmt::print("  {} ran\n", fastest->first->label);
+
+  const double fastest_mean{fastest->second.mean.count()};
+  if (fastest_mean <= 0) {
+    return;
+  }
+
+  for (auto&& result : results) {
+    if (result.first == fastest->first) {
+      continue;
+    }
+
+    // Propagate the relative standard deviation of both means into the ratio.
+    const double mean{result.second.mean.count()};
+    const double ratio{mean / fastest_mean};
+    const double ratio_deviation{
+        ratio * std::sqrt(std::pow(result.second.standard_deviation.count() / mean, 2) +
+                          std::pow(fastest->second.standard_deviation.count() / fastest_mean, 2))};
+
+    fmt::print("    {:.2f} ± {:.2f} times faster than {}\n",
+        ratio,
+        ratio_deviation,
+        result.first->label);
+  }
+}
+
+std::vector<std::string> Benchmark::get_labels(const std::shared_ptr<Instruction>& instruction) {
+  LITR_PROFILE_FUNCTION();
+
+  std::vector<std::string> labels{};
+  std::vector<std::string> parts{};
+  bool skip_value{false};
+  size_t offset{0};
+
+  while (offset < instruction->count()) {
+    const auto code{static_cast<Instruction::Code>(instruction->read(offset++))};
+
+    if (code == Instruction::Code::CLEAR) {
+      parts.clear();
+      continue;
+    }
+
+    const Instruction::Value value{instruction->read_constant(instruction->read_operand(offset))};
+
+    switch (code) {
+      case Instruction::Code::BEGIN_SCOPE: {
+        parts.emplace_back(value);
+        break;
+      }
+      case Instruction::Code::DEFINE: {
+        // Built-in options like the benchmark itself are not part of the label.
+        skip_value = Options::is_builtin(value);
+        if (!skip_value) {
+          parts.push_back(fmt::format("--{}", value));
+        }
+        break;
+      }
+      case Instruction::Code::CONSTANT: {
+        if (!skip_value && !parts.empty()) {
+          parts.back().append(fmt::format("=\"{}\"", value));
+        }
+        break;
+      }
+      case Instruction::Code::EXECUTE: {
+        labels.push_back(fmt::format("{}", fmt::join(parts, " ")));
+        break;
+      }
+      default:
+        break;
+    }
+  }
+
+  return labels;
+}
+
+std::string Benchmark::format_duration(Seconds duration) {
+  LITR_PROFILE_FUNCTION();
+
+  if (duration >= Seconds{1}) {
+    return fmt::format("{:.3f} s", duration.count());
+  }
+
+  constexpr double milliseconds_per_second{1e3};
+  return fmt::format("{:.1f} ms", duration.count() * milliseconds_per_second);
+}
+
+}  // namespace Litr::CLI
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Core/CLI/Instruction.hpp"
+#include "Core/CLI/Interpreter.hpp"
+
+namespace Litr::CLI {
+
+// Runs all instructions multiple times and measures every executed command on
+// its own. Comma separated commands are reported separately, this way different
+// parameter sets can be compared, e.g. `build --target=debug, build --target=release`.
+class Benchmark {
+ public:
+  using Seconds = std::chrono::duration<double>;
+
+  struct Statistics {
+    Seconds mean{0};
+    Seconds standard_deviation{0};
+    Seconds median{0};
+    Seconds min{0};
+    Seconds max{0};
+    size_t outliers{0};
+  };
+
+  Benchmark(
+      const std::shared_ptr<Instruction>& instruction, std::shared_ptr<Interpreter> interpreter);
+
+  void run(size_t runs, size_t warmup);
+  void print_results() const;
+
+  [[nodiscard]] static Statistics get_statistics(std::vector<Seconds> samples);
+  [[nodiscard]] static std::string format_duration(Seconds duration);
+
+ private:
+  struct Measurement {
+    Seconds wall{0};
+    Seconds user{0};
+    Seconds system{0};
+  };
+
+  struct Subject {
+    std::string label;
+    std::vector<Measurement> measurements{};
+
+    explicit Subject(std::string label) : label(std::move(label)) {}
+  };
+
+  void measure(const std::function<void()>& execute);
+  void print_subject(const Subject& subject) const;
+  void print_summary() const;
+
+  [[nodiscard]] static std::vector<std::string> get_labels(
+      const std::shared_ptr<Instruction>& instruction);
+
+  std::shared_ptr<Interpreter> m_interpreter;
+  std::vector<Subject> m_subjects{};
+
+  size_t m_warmup{0};
+  size_t m_current_subject{0};
+  bool m_record{false};
+};
+
+}  // namespace Litr::CLI
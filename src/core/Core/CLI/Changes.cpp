@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Changes.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <system_error>
+#include <unordered_map>
+
+#include "Core/CLI/Shell.hpp"
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/Log.hpp"
+#include "Core/Utils.hpp"
+
+namespace Litr::CLI {
+
+std::shared_ptr<const Changes> Changes::of(const std::string& base_ref) {
+  LITR_PROFILE_FUNCTION();
+
+  // Packages of a workspace ask from multiple threads, git should still run only once.
+  static std::mutex mutex{};
+  static std::unordered_map<std::string, std::shared_ptr<const Changes>> changes{};
+
+  std::lock_guard lock{mutex};
+  std::shared_ptr<const Changes>& result{changes[base_ref]};
+  if (result == nullptr) {
+    result = std::shared_ptr<const Changes>(new Changes(base_ref));
+  }
+
+  return result;
+}
+
+std::shared_ptr<const Changes> Changes::from_files(const std::vector<std::string>& files) {
+  LITR_PROFILE_FUNCTION();
+
+  std::shared_ptr<Changes> changes{new Changes()};
+  changes->m_files.reserve(files.size());
+  for (auto&& file : files) {
+    changes->m_files.push_back(normalize(file));
+  }
+  std::sort(changes->m_files.begin(), changes->m_files.end());
+
+  return changes;
+}
+
+Changes::Changes(const std::string& base_ref) {
+  LITR_PROFILE_FUNCTION();
+
+  // The reference ends up in a shell command.
+  if (!is_valid_reference(base_ref)) {
+    m_error = fmt::format(R"("{}" is not a valid git reference.)", base_ref);
+    return;
+  }
+
+  // Git exits with other codes than a plain failure, anything but success counts. Only its
+  // standard output is read, messages on errors must not end up as file names.
+  const Shell::Result root{Shell::read("git rev-parse --show-toplevel")};
+  if (root.status != ExitStatus::SUCCESS) {
+    m_error = "Changes can only be found inside a git repository.";
+    return;
+  }
+
+  const std::string root_path{Utils::trim_right(Utils::trim_right(root.message, '\n'), '\r')};
+
+  if (!read_files(fmt::format("diff --name-only {}", base_ref), root_path) ||
+      !read_files("ls-files --others --exclude-standard --full-name", root_path)) {
+    m_error = fmt::format(R"(Git could not tell the changes since "{}".)", base_ref);
+    return;
+  }
+
+  std::sort(m_files.begin(), m_files.end());
+  m_files.erase(std::unique(m_files.begin(), m_files.end()), m_files.end());
+  LITR_CORE_TRACE("Found {} changed files since \"{}\"", m_files.size(), base_ref);
+}
+
+bool Changes::contains(const std::string& directory) const {
+  LITR_PROFILE_FUNCTION();
+
+  const std::string prefix{normalize(directory) + '/'};
+  const auto file{std::lower_bound(m_files.begin(), m_files.end(), prefix)};
+
+  return file != m_files.end() && file->compare(0, prefix.size(), prefix) == 0;
+}
+
+bool Changes::matches(const std::string& pattern) const {
+  LITR_PROFILE_FUNCTION();
+
+  const std::string path{normalize(pattern)};
+  const std::string prefix{path + '/'};
+
+  return std::any_of(m_files.begin(), m_files.end(), [&path, &prefix](const std::string& file) {
+    return file.compare(0, prefix.size(), prefix) == 0 || Utils::matches_glob(file, path);
+  });
+}
+
+bool Changes::is_valid_reference(std::string_view base_ref) {
+  LITR_PROFILE_FUNCTION();
+
+  return !base_ref.empty() && base_ref.front() != '-' &&
+         std::all_of(base_ref.begin(), base_ref.end(), [](unsigned char character) {
+           return std::isalnum(character) != 0 ||
+                  std::string_view{"/._-~^@{}"}.find(static_cast<char>(character)) !=
+                      std::string_view::npos;
+         });
+}
+
+bool Changes::read_files(const std::string& arguments, const std::string& root) {
+  LITR_PROFILE_FUNCTION();
+
+  // Git runs inside the repository itself, the root may contain spaces.
+  const Shell::Result result{Shell::read(fmt::format(R"(git -C "{}" {})", root, arguments))};
+  if (result.status != ExitStatus::SUCCESS) {
+    return false;
+  }
+
+  std::deque<std::string_view> files{};
+  Utils::split_into(result.message, '\n', files);
+
+  for (auto&& file : files) {
+    const std::string_view name{Utils::trim_right(file, '\r')};
+    if (!name.empty()) {
+      m_files.push_back(fmt::format("{}/{}", root, name));
+    }
+  }
+
+  return true;
+}
+
+std::string Changes::normalize(const std::string& path) {
+  LITR_PROFILE_FUNCTION();
+
+  // Git reports the real path of the repository, links on the way need to be resolved.
+  std::error_code error{};
+  const std::filesystem::path absolute{std::filesystem::absolute(path, error)};
+  const std::string normalized{std::filesystem::weakly_canonical(absolute, error).string()};
+
+  return std::string{Utils::trim_right(normalized, '/')};
+}
+
+}  // namespace Litr::CLI
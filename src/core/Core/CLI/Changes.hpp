@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Litr::CLI {
+
+// Files changed in the git repository of the current directory compared to a base
+// reference, including changes not committed yet and files git does not track so far.
+class Changes {
+ public:
+  // Asks git only once for every base reference, later calls share the result.
+  [[nodiscard]] static std::shared_ptr<const Changes> of(const std::string& base_ref);
+  // Changes known without asking git, e.g. files seen changing while watching them.
+  [[nodiscard]] static std::shared_ptr<const Changes> from_files(
+      const std::vector<std::string>& files);
+
+  // Empty if git could tell what changed.
+  [[nodiscard]] inline const std::string& get_error() const {
+    return m_error;
+  }
+  [[nodiscard]] inline const std::vector<std::string>& get_files() const {
+    return m_files;
+  }
+
+  // Tells if any file inside the directory changed.
+  [[nodiscard]] bool contains(const std::string& directory) const;
+  // Tells if any changed file matches the pattern, or is inside the directory it names.
+  [[nodiscard]] bool matches(const std::string& pattern) const;
+
+  [[nodiscard]] static bool is_valid_reference(std::string_view base_ref);
+
+ private:
+  Changes() = default;
+  explicit Changes(const std::string& base_ref);
+
+  [[nodiscard]] bool read_files(const std::string& arguments, const std::string& root);
+  [[nodiscard]] static std::string normalize(const std::string& path);
+
+  // Absolute and sorted, to find files of a directory without looking at all of them.
+  std::vector<std::string> m_files{};
+  std::string m_error{};
+};
+
+}  // namespace Litr::CLI
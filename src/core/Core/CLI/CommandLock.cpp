@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "CommandLock.hpp"
+
+#include <fmt/format.h>
+
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <utility>
+
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/Environment.hpp"
+#include "Core/Utils.hpp"
+
+namespace Litr::CLI {
+
+/** @private */
+static Path create_directory(const Path& directory) {
+  std::error_code error{};
+  std::filesystem::create_directories(directory.to_string(), error);
+  return directory;
+}
+
+CommandLock::CommandLock(const std::string& command_path,
+    const std::string& dir,
+    const std::vector<std::string>& scripts)
+    : CommandLock(Environment::get_cache_directory().append(std::string{"locks"}),
+          command_path,
+          dir,
+          scripts) {}
+
+CommandLock::CommandLock(const Path& directory,
+    const std::string& command_path,
+    const std::string& dir,
+    const std::vector<std::string>& scripts)
+    : m_result_path(create_directory(directory).append(
+          fmt::format("{}.result", Utils::to_hex(create_key(command_path, dir))))),
+      m_waiting_path(directory.append(
+          fmt::format("{}.waiting", Utils::to_hex(create_key(command_path, dir))))),
+      m_scripts_key(create_scripts_key(scripts)),
+      m_lock(directory.append(Utils::to_hex(create_key(command_path, dir)))) {}
+
+bool CommandLock::try_lock() {
+  LITR_PROFILE_FUNCTION();
+
+  m_wait_start = ResultFile::Clock::now();
+
+  // Without a lock file nothing can be coordinated, the command runs as it always did.
+  if (!m_lock.is_open()) {
+    return true;
+  }
+
+  std::error_code error{};
+  if (m_lock.try_lock()) {
+    // A result left from an earlier run is of no use to anyone waiting from now on.
+    std::filesystem::remove(m_result_path.to_string(), error);
+    return true;
+  }
+
+  // Tells the invocation holding the lock to leave its result.
+  const std::ofstream waiting{m_waiting_path.to_string(), std::ios::app};
+  return false;
+}
+
+std::optional<Shell::Result> CommandLock::wait() {
+  LITR_PROFILE_FUNCTION();
+
+  if (!m_lock.lock()) {
+    return std::nullopt;
+  }
+
+  std::optional<ResultFile> file{ResultFile::read(m_result_path)};
+  if (!file.has_value() || file->key != m_scripts_key || file->created < m_wait_start) {
+    return std::nullopt;
+  }
+
+  return std::move(file->result);
+}
+
+void CommandLock::set_result(const Shell::Result& result) const {
+  LITR_PROFILE_FUNCTION();
+
+  // Nobody waits, nothing is written.
+  std::error_code error{};
+  if (!std::filesystem::remove(m_waiting_path.to_string(), error)) {
+    return;
+  }
+
+  static_cast<void>(ResultFile::write(m_result_path, result, m_scripts_key));
+}
+
+uint64_t CommandLock::create_key(const std::string& command_path, const std::string& dir) {
+  LITR_PROFILE_FUNCTION();
+
+  // Commands without a directory run in the current one.
+  const Path directory{FileSystem::get_absolute_path(Path(dir))};
+
+  return Utils::hash(
+      fmt::format("{}\n{}\n", command_path, Utils::trim_right(directory.to_string(), '/')));
+}
+
+uint64_t CommandLock::create_scripts_key(const std::vector<std::string>& scripts) {
+  LITR_PROFILE_FUNCTION();
+
+  // Scripts are parsed already, different parameters lead to different scripts.
+  uint64_t key{Utils::hash("")};
+  for (auto&& script : scripts) {
+    key = Utils::hash(fmt::format("{}\n", script), key);
+  }
+
+  return key;
+}
+
+}  // namespace Litr::CLI
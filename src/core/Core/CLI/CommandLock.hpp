@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Core/CLI/ResultFile.hpp"
+#include "Core/CLI/Shell.hpp"
+#include "Core/FileLock.hpp"
+#include "Core/FileSystem.hpp"
+
+namespace Litr::CLI {
+
+// Keeps invocations of litr from running the same command in the same directory at once,
+// e.g. two terminals both running `build`, so they do not write the same files. The lock
+// is released with this instance.
+class CommandLock {
+ public:
+  CommandLock(const std::string& command_path,
+      const std::string& dir,
+      const std::vector<std::string>& scripts);
+  CommandLock(const Path& directory,
+      const std::string& command_path,
+      const std::string& dir,
+      const std::vector<std::string>& scripts);
+
+  // Takes the lock only if no other invocation runs the command right now, otherwise the
+  // one running it is told to leave its result.
+  [[nodiscard]] bool try_lock();
+  // Waits for the other invocation to finish. If it ran the very same scripts, its result
+  // is returned to be used instead of running them again.
+  [[nodiscard]] std::optional<Shell::Result> wait();
+  // Leaves the result for invocations waiting right now, only if there are any.
+  void set_result(const Shell::Result& result) const;
+
+ private:
+  [[nodiscard]] static uint64_t create_key(const std::string& command_path,
+      const std::string& dir);
+  [[nodiscard]] static uint64_t create_scripts_key(const std::vector<std::string>& scripts);
+
+  const Path m_result_path;
+  const Path m_waiting_path;
+  const uint64_t m_scripts_key;
+  FileLock m_lock;
+  // Only results created after this are from a run the invocation waited for.
+  ResultFile::Clock::time_point m_wait_start{};
+};
+
+}  // namespace Litr::CLI
@@ -4,6 +4,7 @@
 
 #include "Instruction.hpp"
 
+#include <limits>
 #include <utility>
 
 #include "Core/Debug/Instrumentor.hpp"
@@ -34,17 +35,68 @@ size_t Instruction::count() const {
   return m_byte_code.size();
 }
 
-std::byte Instruction::write_constant(const Instruction::Value& value) {
+void Instruction::write_operand(size_t operand) {
   LITR_PROFILE_FUNCTION();
 
-  m_constants.push_back(value);
-  return static_cast<std::byte>(m_constants.size() - 1);
+  constexpr size_t payload_bits{7};
+  constexpr size_t payload_mask{0x7F};
+  constexpr size_t continuation_bit{0x80};
+
+  while (operand > payload_mask) {
+    write(static_cast<std::byte>((operand & payload_mask) | continuation_bit));
+    operand >>= payload_bits;
+  }
+
+  write(static_cast<std::byte>(operand));
+}
+
+size_t Instruction::read_operand(size_t& offset) const {
+  LITR_PROFILE_FUNCTION();
+
+  constexpr size_t payload_bits{7};
+  constexpr std::byte payload_mask{0x7F};
+  constexpr std::byte continuation_bit{0x80};
+
+  size_t operand{0};
+  size_t shift{0};
+
+  // Malformed byte code missing its last byte stops at the end instead of reading past it.
+  // Overlong operands still consume all their bytes, but bits beyond the width of size_t
+  // are dropped, shifting by the full width or more is undefined.
+  while (offset < m_byte_code.size()) {
+    const std::byte byte{m_byte_code[offset++]};
+    if (shift < std::numeric_limits<size_t>::digits) {
+      operand |= static_cast<size_t>(byte & payload_mask) << shift;
+      shift += payload_bits;
+    }
+    if ((byte & continuation_bit) == std::byte{0}) {
+      break;
+    }
+  }
+
+  return operand;
+}
+
+size_t Instruction::write_constant(Instruction::Value value) {
+  LITR_PROFILE_FUNCTION();
+
+  // Interned values are unique by address, no need to compare the characters.
+  const Value interned{m_strings.intern(value)};
+  const auto existing{m_constant_indices.find(interned.data())};
+  if (existing != m_constant_indices.end()) {
+    return existing->second;
+  }
+
+  m_constants.push_back(interned);
+  const size_t index{m_constants.size() - 1};
+  m_constant_indices.emplace(interned.data(), index);
+  return index;
 }
 
-Instruction::Value Instruction::read_constant(const std::byte index) const {
+Instruction::Value Instruction::read_constant(const size_t index) const {
   LITR_PROFILE_FUNCTION();
 
-  return m_constants[static_cast<size_t>(index)];
+  return m_constants[index];
 }
 
 }  // namespace Litr::CLI
@@ -6,14 +6,19 @@
 
 #include <cstddef>
 #include <cstring>
-#include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
+#include "Core/StringPool.hpp"
+
 namespace Litr::CLI {
 
 class Instruction {
  public:
-  using Value = std::string;
+  // Constants are interned, equal values are stored once and share the same index.
+  // A value stays valid for the lifetime of the instruction.
+  using Value = std::string_view;
 
   enum class Code : unsigned char {
     CLEAR,        // Comma operator
@@ -31,12 +36,20 @@ class Instruction {
   [[nodiscard]] std::byte read(size_t offset) const;
   [[nodiscard]] size_t count() const;
 
-  std::byte write_constant(const Value& value);
-  [[nodiscard]] Value read_constant(std::byte index) const;
+  // Operands are written as unsigned LEB128, seven bits per byte with the highest bit
+  // set on every byte but the last. Small operands take one byte, larger ones are not
+  // limited by it. Reading an operand moves the offset behind it.
+  void write_operand(size_t operand);
+  [[nodiscard]] size_t read_operand(size_t& offset) const;
+
+  size_t write_constant(Value value);
+  [[nodiscard]] Value read_constant(size_t index) const;
 
  private:
   std::vector<std::byte> m_byte_code{};
   std::vector<Value> m_constants{};
+  std::unordered_map<const char*, size_t> m_constant_indices{};
+  StringPool m_strings{};
 };
 
 }  // namespace Litr::CLI
@@ -4,11 +4,19 @@
 
 #include "Interpreter.hpp"
 
+#include <fmt/color.h>
+
 #include <algorithm>
+#include <iterator>
+#include <optional>
+#include <utility>
 
-#include "Core/CLI/Shell.hpp"
+#include "Core/Debug/AllocationTracker.hpp"
 #include "Core/Debug/Instrumentor.hpp"
 #include "Core/ExitStatus.hpp"
+#include "Core/FileSystem.hpp"
+#include "Core/Log.hpp"
+#include "Core/ProcessTracer.hpp"
 #include "Core/Script/Compiler.hpp"
 #include "Core/Utils.hpp"
 
@@ -24,13 +32,21 @@ static void command_path_to_human_readable(std::string& path) {
 Interpreter::Interpreter(
     const std::shared_ptr<Instruction>& instruction, const std::shared_ptr<Config::Loader>& config)
     : m_instruction(instruction),
-      m_query(config) {
+      m_query(config),
+      m_options(instruction) {
   define_default_variables(config);
 }
 
 void Interpreter::execute() {
   LITR_PROFILE_FUNCTION();
-
+  LITR_ALLOCATION_PHASE(EXECUTION);
+
+  // Reset to the root scope holding the default variables, instructions can be executed again.
+  // Directories may have been created or removed since, patterns are expanded anew.
+  m_scope.erase(std::next(m_scope.begin()), m_scope.end());
+  m_expanded_directories.clear();
+  m_stop_execution = false;
+  m_cancelled = false;
   m_offset = 0;
 
   while (m_offset < m_instruction->count()) {
@@ -41,11 +57,58 @@ void Interpreter::execute() {
   }
 }
 
-Instruction::Value Interpreter::read_current_value() const {
+void Interpreter::set_execution_hook(const ExecutionHook& hook) {
+  LITR_PROFILE_FUNCTION();
+
+  m_execution_hook = hook;
+}
+
+void Interpreter::set_default_directory(const Path& directory) {
+  LITR_PROFILE_FUNCTION();
+
+  m_default_directory = directory;
+}
+
+void Interpreter::set_output(const Shell::ExecCallback& output) {
+  LITR_PROFILE_FUNCTION();
+
+  m_output = output;
+}
+
+void Interpreter::set_changes(const std::shared_ptr<const Changes>& changes) {
+  LITR_PROFILE_FUNCTION();
+
+  m_changes = changes;
+}
+
+void Interpreter::set_cancel_check(const CancelCheck& check) {
   LITR_PROFILE_FUNCTION();
 
-  const std::byte index{m_instruction->read(m_offset)};
-  return m_instruction->read_constant(index);
+  m_cancel_check = check;
+}
+
+void Interpreter::set_journal(const std::shared_ptr<Journal>& journal) {
+  LITR_PROFILE_FUNCTION();
+
+  m_journal = journal;
+}
+
+void Interpreter::set_resources(const std::shared_ptr<Resources>& resources) {
+  LITR_PROFILE_FUNCTION();
+
+  m_resources = resources;
+}
+
+void Interpreter::set_throttle(Throttle* throttle) {
+  LITR_PROFILE_FUNCTION();
+
+  m_throttle = throttle;
+}
+
+Instruction::Value Interpreter::read_current_value() {
+  LITR_PROFILE_FUNCTION();
+
+  return m_instruction->read_constant(m_instruction->read_operand(m_offset));
 }
 
 Interpreter::Variables Interpreter::get_scope_variables() const {
@@ -88,7 +151,7 @@ void Interpreter::define_default_variables(const std::shared_ptr<Config::Loader>
 void Interpreter::execute_instruction() {
   LITR_PROFILE_FUNCTION();
 
-  const Instruction::Code code{m_instruction->read(m_offset++)};
+  const auto code{static_cast<Instruction::Code>(m_instruction->read(m_offset++))};
 
   switch (code) {
     case Instruction::Code::CLEAR:
@@ -115,7 +178,7 @@ void Interpreter::begin_scope() {
   LITR_PROFILE_FUNCTION();
 
   m_scope.emplace_back(Variables());
-  ++m_offset;
+  static_cast<void>(m_instruction->read_operand(m_offset));
 }
 
 void Interpreter::clear_scope() {
@@ -128,6 +191,12 @@ void Interpreter::define_variable() {
   LITR_PROFILE_FUNCTION();
 
   const Instruction::Value name{read_current_value()};
+
+  if (Options::is_builtin(name)) {
+    skip_builtin_option();
+    return;
+  }
+
   const std::shared_ptr<Config::Parameter>& param{m_query.get_parameter(name)};
 
   if (param == nullptr) {
@@ -156,8 +225,18 @@ void Interpreter::define_variable() {
 
   m_current_variable_name = variable.name;
   m_scope.back().insert_or_assign(variable.name, variable);
+}
 
-  ++m_offset;
+void Interpreter::skip_builtin_option() {
+  LITR_PROFILE_FUNCTION();
+
+  // Built-in options are already collected by `Options`, including any assigned value.
+  if (m_offset < m_instruction->count() &&
+      static_cast<Instruction::Code>(m_instruction->read(m_offset)) ==
+          Instruction::Code::CONSTANT) {
+    ++m_offset;
+    static_cast<void>(m_instruction->read_operand(m_offset));
+  }
 }
 
 void Interpreter::set_constant() {
@@ -169,7 +248,7 @@ void Interpreter::set_constant() {
 
   switch (param->type) {
     case Config::Parameter::Type::STRING: {
-      variable.value = value;
+      variable.value = std::string{value};
       break;
     }
     case Config::Parameter::Type::ARRAY: {
@@ -187,7 +266,7 @@ void Interpreter::set_constant() {
                 Utils::trim_right(options, ','))));
         return;
       }
-      variable.value = value;
+      variable.value = std::string{value};
       break;
     }
     case Config::Parameter::Type::BOOLEAN: {
@@ -208,14 +287,19 @@ void Interpreter::set_constant() {
   }
 
   m_scope.back().insert_or_assign(variable.name, variable);
-  ++m_offset;
 }
 
 void Interpreter::call_instruction() {
   LITR_PROFILE_FUNCTION();
 
   const Instruction::Value name{read_current_value()};
-  const std::shared_ptr<Config::Command> command{m_query.get_command(name)};
+  const Config::Command* command{m_query.get_command(name)};
+
+  // Commands are built once first used, their configuration errors only show up now.
+  if (Error::Handler::has_errors()) {
+    m_stop_execution = true;
+    return;
+  }
 
   if (command == nullptr) {
     handle_error(Error::CommandNotFoundError(fmt::format(
@@ -224,24 +308,27 @@ void Interpreter::call_instruction() {
     return;
   }
 
-  call_command(command);
-  ++m_offset;
+  if (m_execution_hook) {
+    m_execution_hook(name, [this, command]() { call_command(*command); });
+  } else {
+    call_command(*command);
+  }
 }
 
 // Ignore recursive call of child commands.
 // NOLINTNEXTLINE(misc-no-recursion)
-void Interpreter::call_command(
-    const std::shared_ptr<Config::Command>& command, const std::string& scope) {
+void Interpreter::call_command(const Config::Command& command, const std::string& scope) {
   LITR_PROFILE_FUNCTION();
 
-  std::string command_path{scope + command->name};
+  std::string command_path{scope};
+  command_path.append(command.name);
 
   validate_required_parameters(command);
   if (m_stop_execution) {
     return;
   }
 
-  const bool print_result{command->output == Config::Command::Output::SILENT};
+  const bool print_result{command.output == Config::Command::Output::SILENT};
   const Scripts scripts{parse_scripts(command)};
   if (m_stop_execution) {
     return;
@@ -249,11 +336,16 @@ void Interpreter::call_command(
 
   command_path_to_human_readable(command_path);
 
-  if (command->directory.empty()) {
-    run_scripts(scripts, command_path, "", print_result);
+  if (command.directory.empty()) {
+    run_scripts(
+        scripts, command, command_path, m_default_directory.to_string(), print_result);
   } else {
-    for (auto&& dir : command->directory) {
-      run_scripts(scripts, command_path, dir, print_result);
+    for (auto&& dir : get_directories(command)) {
+      if (!is_affected(command, dir)) {
+        LITR_CORE_TRACE("Skip \"{}\" in {}, nothing changed", command_path, dir);
+        continue;
+      }
+      run_scripts(scripts, command, command_path, dir, print_result);
     }
   }
 
@@ -266,12 +358,11 @@ void Interpreter::call_command(
 
 // Ignore recursive call of child commands.
 // NOLINTNEXTLINE(misc-no-recursion)
-void Interpreter::call_child_commands(
-    const std::shared_ptr<Config::Command>& command, const std::string& scope) {
+void Interpreter::call_child_commands(const Config::Command& command, const std::string& scope) {
   LITR_PROFILE_FUNCTION();
 
-  if (!command->child_commands.empty()) {
-    for (auto&& child_command : command->child_commands) {
+  if (!command.child_commands.empty()) {
+    for (auto&& child_command : command.child_commands) {
       if (m_stop_execution) {
         return;
       }
@@ -280,34 +371,296 @@ void Interpreter::call_child_commands(
   }
 }
 
+std::vector<std::string> Interpreter::get_directories(const Config::Command& command) {
+  LITR_PROFILE_FUNCTION();
+
+  std::vector<std::string> directories{};
+
+  for (auto&& dir : command.directory) {
+    if (!FileSystem::has_wildcards(dir)) {
+      directories.emplace_back(dir);
+      continue;
+    }
+
+    // Patterns are expanded when used, so they see the directories as they are right now.
+    auto expanded{m_expanded_directories.find(std::string{dir})};
+    if (expanded == m_expanded_directories.end()) {
+      // Directories ignored by git are mostly build output and dependencies, not packages.
+      const bool respect_git_ignore{!m_options.has("no-ignore")};
+      std::vector<std::string> matches{};
+      for (auto&& match : FileSystem::glob_directories(std::string{dir}, respect_git_ignore)) {
+        matches.push_back(match.to_string());
+      }
+      LITR_CORE_TRACE("Directory pattern \"{}\" matches {} directories", dir, matches.size());
+
+      // A pattern matching nothing would silently run none of the scripts of the command.
+      if (matches.empty()) {
+        handle_error(Error::ExecutionFailureError(
+            fmt::format(R"(The directory pattern "{}" of command "{}" matches no directory.)",
+                dir,
+                command.name)));
+        return {};
+      }
+      expanded = m_expanded_directories.emplace(std::string{dir}, std::move(matches)).first;
+    }
+
+    directories.insert(directories.end(), expanded->second.begin(), expanded->second.end());
+  }
+
+  m_used_directories.insert(directories.begin(), directories.end());
+  return directories;
+}
+
+bool Interpreter::is_affected(const Config::Command& command, const std::string& dir) {
+  LITR_PROFILE_FUNCTION();
+
+  if (m_changes == nullptr && !m_options.has("affected")) {
+    return true;
+  }
+
+  if (m_changes == nullptr) {
+    const std::string base_ref{m_options.get("affected")};
+    m_changes = Changes::of(base_ref.empty() ? "HEAD" : base_ref);
+
+    if (!m_changes->get_error().empty()) {
+      handle_error(Error::ExecutionFailureError(m_changes->get_error()));
+    }
+  }
+
+  if (!m_changes->get_error().empty()) {
+    return false;
+  }
+
+  if (m_changes->contains(dir)) {
+    return true;
+  }
+
+  return std::any_of(command.affects.begin(),
+      command.affects.end(),
+      [this](std::string_view path) { return m_changes->matches(std::string{path}); });
+}
+
 void Interpreter::run_scripts(const Scripts& scripts,
+    const Config::Command& command,
     const std::string& command_path,
     const std::string& dir,
     bool print_result) {
   LITR_PROFILE_FUNCTION();
 
+  if (scripts.empty()) {
+    return;
+  }
+
+  // Nothing could stop the scripts in time, they do not run instead of maybe running forever.
+  if (!Process::is_supported() && get_limits(command).timeout.count() > 0) {
+    handle_error(Error::TimeoutError(fmt::format(
+        R"(The command defined in "{}" has a timeout, which is not supported on this system.)",
+        command_path)));
+    return;
+  }
+
   Path path{dir};
+  size_t skipped{0};
+
+  const Resources::Lease lease{m_resources.get(), command.resources};
+
+  // Another invocation running the same command is waited for, instead of both writing
+  // the same files. Its result is used if it ran the very same scripts.
+  CommandLock lock{command_path, dir, scripts};
+  if (!lock.try_lock()) {
+    print_lock_status(command_path, dir, "Waiting for another run to finish");
+    if (const std::optional<Shell::Result> result{lock.wait()}) {
+      print_lock_status(command_path, dir, "Reused the result of the other run");
+      replay_result(*result, command_path, print_result);
+      return;
+    }
+  }
+
+  // Waiting for resources or another run holds no place, others can run meanwhile.
+  const Throttle::Slot slot{m_throttle};
+
+  // Output of every script, left for invocations waiting for this one.
+  Shell::Result outcome{};
 
   for (auto&& script : scripts) {
-    Shell::Result result{
-        print_result ? Shell::exec(script, path) : Shell::exec(script, path, print)};
+    if (m_cancel_check && m_cancel_check()) {
+      m_stop_execution = true;
+      m_cancelled = true;
+      return;
+    }
 
-    if (result.status == ExitStatus::FAILURE) {
+    const Journal::Step step{
+        m_journal != nullptr ? m_journal->create_step(command_path, dir, script) : ""};
+    if (m_journal != nullptr && m_journal->is_done(step)) {
+      ++skipped;
+      continue;
+    }
+    if (skipped > 0) {
+      print_skipped(command_path, dir, skipped);
+      skipped = 0;
+    }
+
+    if (is_traced(command) &&
+        m_traced_inputs.is_unchanged(OutputCache::create_key(script, path, {}))) {
+      print_unchanged(command_path, dir);
+      if (m_journal != nullptr) {
+        m_journal->mark_done(step);
+      }
+      continue;
+    }
+
+    Shell::Result result{};
+
+    if (m_options.has("perf")) {
+      Debug::PerfCounter counter{};
+      counter.start();
+      result = run_script(script, path, command, print_result);
+      counter.stop();
+      print_perf_counters(command_path, dir, counter.get_values());
+    } else {
+      result = run_script(script, path, command, print_result);
+    }
+
+    outcome.message.append(result.message);
+
+    // The script did not finish, like the ones not started it is neither failed nor done.
+    if (result.cancelled) {
+      m_stop_execution = true;
+      m_cancelled = true;
+      return;
+    }
+
+    if (result.timed_out) {
+      outcome.status = ExitStatus::FAILURE;
+      lock.set_result(outcome);
+      handle_error(Error::TimeoutError(fmt::format(
+          "The command defined in \"{}\" did not finish in time and got stopped.", command_path)));
+      return;
+    }
+
+    if (result.status != ExitStatus::SUCCESS) {
+      outcome.status = result.status;
+      lock.set_result(outcome);
       handle_error(Error::ExecutionFailureError(
           fmt::format("Problem executing the command defined in \"{}\".", command_path)));
       return;
     }
+
+    if (m_journal != nullptr) {
+      m_journal->mark_done(step);
+    }
+  }
+
+  lock.set_result(outcome);
+
+  if (skipped > 0) {
+    print_skipped(command_path, dir, skipped);
+  }
+}
+
+void Interpreter::replay_result(
+    const Shell::Result& result, const std::string& command_path, bool print_result) {
+  LITR_PROFILE_FUNCTION();
+
+  if (!print_result && !m_options.has("bench")) {
+    if (m_output) {
+      m_output(result.message);
+    } else {
+      print(result.message);
+    }
+  }
+
+  if (result.status != ExitStatus::SUCCESS) {
+    handle_error(Error::ExecutionFailureError(
+        fmt::format("Problem executing the command defined in \"{}\".", command_path)));
+  }
+}
+
+Shell::Result Interpreter::run_script(const std::string& script,
+    const Path& path,
+    const Config::Command& command,
+    bool print_result) const {
+  LITR_PROFILE_FUNCTION();
+
+  // Benchmarks measure the scripts only, printing their output would distort the result.
+  const bool silent{print_result || m_options.has("bench")};
+  const Config::Command::Cache& cache{command.cache};
+  const bool is_cached{cache.ttl.count() > 0};
+  const uint64_t key{is_cached ? OutputCache::create_key(script, path, cache.env) : 0};
+
+  if (is_cached) {
+    if (std::optional<Shell::Result> result{m_output_cache.get(key, cache.ttl)}) {
+      if (!silent && m_output) {
+        m_output(result->message);
+      } else if (!silent) {
+        print(result->message);
+      }
+      return std::move(*result);
+    }
+  }
+
+  Shell::ExecCallback output{print};
+  if (silent) {
+    output = []([[maybe_unused]] const std::string& _buffer) {};
+  } else if (m_output) {
+    output = m_output;
+  }
+
+  const Process::Limits limits{get_limits(command)};
+  Shell::Result result{};
+  if (is_traced(command)) {
+    Shell::Trace trace{Shell::trace(script, path, output, limits, m_cancel_check)};
+    // A command that could not be traced would be skipped forever, nothing is kept then.
+    if (trace.result.status == ExitStatus::SUCCESS && !trace.files.empty()) {
+      m_traced_inputs.set(OutputCache::create_key(script, path, {}), trace.files);
+    }
+    result = std::move(trace.result);
+  } else {
+    result = Shell::exec(script, path, output, limits, m_cancel_check);
+  }
+
+  // Output cut off by a timeout or cancelling is no output to reuse.
+  if (is_cached && !result.timed_out && !result.cancelled) {
+    m_output_cache.set(key, result);
+  }
+
+  return result;
+}
+
+bool Interpreter::is_traced(const Config::Command& command) {
+  LITR_PROFILE_FUNCTION();
+
+  return command.inputs == Config::Command::Inputs::TRACED && ProcessTracer::is_supported();
+}
+
+Process::Limits Interpreter::get_limits(const Config::Command& command) const {
+  LITR_PROFILE_FUNCTION();
+
+  const Config::Command::Limits& limits{command.limits};
+  Process::Limits process{limits.nice, {}, limits.memory, limits.open_files, command.timeout};
+
+  // The timeout of a command goes before the one for all of them, checked on start already.
+  if (process.timeout.count() == 0 && m_options.has("timeout")) {
+    process.timeout = Utils::parse_duration(m_options.get("timeout")).value_or(process.timeout);
+  }
+
+  // The list got checked on load already.
+  if (!limits.cpus.empty()) {
+    process.cpus = Utils::parse_cpus(limits.cpus).value_or(std::vector<size_t>{});
   }
+
+  return process;
 }
 
-Interpreter::Scripts Interpreter::parse_scripts(const std::shared_ptr<Config::Command>& command) {
+Interpreter::Scripts Interpreter::parse_scripts(const Config::Command& command) {
   LITR_PROFILE_FUNCTION();
 
   size_t location{0};
   Scripts scripts{};
 
-  for (auto&& script : command->script) {
-    const std::string parsed_script{parse_script(script, command->Locations[location])};
+  for (auto&& script : command.script) {
+    const std::string parsed_script{
+        parse_script(std::string{script}, command.Locations[location])};
     if (m_stop_execution) {
       break;
     }
@@ -348,10 +701,10 @@ enum Variable::Type Interpreter::get_variable_type(
   return {};
 }
 
-void Interpreter::validate_required_parameters(const std::shared_ptr<Config::Command>& command) {
+void Interpreter::validate_required_parameters(const Config::Command& command) {
   LITR_PROFILE_FUNCTION();
 
-  const auto params{m_query.get_parameters(command->name)};
+  const auto params{m_query.get_parameters(command.name)};
 
   for (auto&& param : params) {
     if (!is_variable_defined(param->name)) {
@@ -391,4 +744,78 @@ void Interpreter::print(const std::string& message) {
   fmt::print("{}", message);
 }
 
+void Interpreter::print_skipped(
+    const std::string& command_path, const std::string& dir, size_t count) {
+  LITR_PROFILE_FUNCTION();
+
+  std::string task{command_path};
+  if (!dir.empty()) {
+    task.append(fmt::format(" ({})", dir));
+  }
+
+  fmt::print(fg(fmt::color::dark_gray),
+      "[resume] {}: Skipped {} {} done before.\n",
+      task,
+      count,
+      count == 1 ? "script" : "scripts");
+}
+
+void Interpreter::print_unchanged(const std::string& command_path, const std::string& dir) {
+  LITR_PROFILE_FUNCTION();
+
+  std::string task{command_path};
+  if (!dir.empty()) {
+    task.append(fmt::format(" ({})", dir));
+  }
+
+  fmt::print(fg(fmt::color::dark_gray), "[inputs] {}: Skipped, no traced input changed.\n", task);
+}
+
+void Interpreter::print_lock_status(
+    const std::string& command_path, const std::string& dir, const std::string& message) {
+  LITR_PROFILE_FUNCTION();
+
+  std::string task{command_path};
+  if (!dir.empty()) {
+    task.append(fmt::format(" ({})", dir));
+  }
+
+  fmt::print(fg(fmt::color::dark_gray), "[lock] {}: {}.\n", task, message);
+}
+
+void Interpreter::print_perf_counters(const std::string& command_path,
+    const std::string& dir,
+    const Debug::PerfCounter::Values& values) {
+  LITR_PROFILE_FUNCTION();
+
+  std::string task{command_path};
+  if (!dir.empty()) {
+    task.append(fmt::format(" ({})", dir));
+  }
+
+  if (values.empty()) {
+    fmt::print(fg(fmt::color::dark_gray), "[perf] {}: No performance counters available.\n", task);
+    return;
+  }
+
+  std::string counters{};
+  for (auto&& value : values) {
+    switch (value.unit) {
+      case Debug::PerfCounter::Value::Unit::NANOSECONDS: {
+        constexpr double nanoseconds_per_millisecond{1e6};
+        counters.append(fmt::format(" | {}: {:.3f} ms",
+            value.name,
+            static_cast<double>(value.count) / nanoseconds_per_millisecond));
+        break;
+      }
+      case Debug::PerfCounter::Value::Unit::COUNT: {
+        counters.append(fmt::format(" | {}: {}", value.name, value.count));
+        break;
+      }
+    }
+  }
+
+  fmt::print(fg(fmt::color::dark_gray), "[perf] {}{}\n", task, counters);
+}
+
 }  // namespace Litr::CLI
@@ -6,17 +6,29 @@
 
 #include <functional>
 #include <memory>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "Core/CLI/Changes.hpp"
+#include "Core/CLI/CommandLock.hpp"
 #include "Core/CLI/Instruction.hpp"
+#include "Core/CLI/Journal.hpp"
+#include "Core/CLI/Options.hpp"
+#include "Core/CLI/OutputCache.hpp"
+#include "Core/CLI/Resources.hpp"
+#include "Core/CLI/Shell.hpp"
+#include "Core/CLI/Throttle.hpp"
+#include "Core/CLI/TracedInputs.hpp"
 #include "Core/CLI/Variable.hpp"
 #include "Core/Config/Loader.hpp"
 #include "Core/Config/Location.hpp"
 #include "Core/Config/Query.hpp"
+#include "Core/Debug/PerfCounter.hpp"
 #include "Core/Error/Handler.hpp"
+#include "Core/Process.hpp"
 
 namespace Litr::CLI {
 
@@ -25,13 +37,44 @@ class Interpreter {
   using Scripts = std::vector<std::string>;
 
  public:
+  // Wraps the execution of a command called from the command line, e.g. to measure it.
+  using ExecutionHook =
+      std::function<void(const Instruction::Value& name, const std::function<void()>& execute)>;
+  // Asked before every script and while one runs, execution stops as soon as it returns
+  // true. A script still running is ended then, where processes can be, see `Process`.
+  using CancelCheck = Process::CancelCheck;
+
   Interpreter(const std::shared_ptr<Instruction>& instruction,
       const std::shared_ptr<Config::Loader>& config);
 
   void execute();
+  void set_execution_hook(const ExecutionHook& hook);
+  // Commands without a directory of their own run inside this one, instead of the current.
+  void set_default_directory(const Path& directory);
+  // Receives the output of scripts instead of the terminal.
+  void set_output(const Shell::ExecCallback& output);
+  // Only directories with changed files run, the same as with `--affected`.
+  void set_changes(const std::shared_ptr<const Changes>& changes);
+  void set_cancel_check(const CancelCheck& check);
+  // Scripts done as of the journal are skipped, the ones done now are added to it.
+  void set_journal(const std::shared_ptr<Journal>& journal);
+  // Commands declaring resources wait for them, shared with interpreters on other threads.
+  void set_resources(const std::shared_ptr<Resources>& resources);
+  // Scripts of a command only run with a place of the throttle, taken once its resources
+  // are. Without one they run right away.
+  void set_throttle(Throttle* throttle);
+
+  [[nodiscard]] inline bool is_cancelled() const {
+    return m_cancelled;
+  }
+  // Every directory of the commands called so far, as written or matched by a pattern.
+  [[nodiscard]] inline const std::set<std::string>& get_used_directories() const {
+    return m_used_directories;
+  }
 
  private:
-  [[nodiscard]] Instruction::Value read_current_value() const;
+  // Reads the constant of the current operand and moves the offset behind it.
+  [[nodiscard]] Instruction::Value read_current_value();
   [[nodiscard]] Variables get_scope_variables() const;
   void define_default_variables(const std::shared_ptr<Config::Loader>& config);
 
@@ -40,36 +83,71 @@ class Interpreter {
   void begin_scope();
   void clear_scope();
   void define_variable();
+  void skip_builtin_option();
   void set_constant();
   void call_instruction();
 
-  void call_command(const std::shared_ptr<Config::Command>& command, const std::string& scope = "");
-  void call_child_commands(
-      const std::shared_ptr<Config::Command>& command, const std::string& scope);
+  void call_command(const Config::Command& command, const std::string& scope = "");
+  void call_child_commands(const Config::Command& command, const std::string& scope);
+  [[nodiscard]] std::vector<std::string> get_directories(const Config::Command& command);
+  [[nodiscard]] bool is_affected(const Config::Command& command, const std::string& dir);
   void run_scripts(const Scripts& scripts,
+      const Config::Command& command,
       const std::string& command_path,
       const std::string& dir,
       bool print_result);
-
-  [[nodiscard]] Scripts parse_scripts(const std::shared_ptr<Config::Command>& command);
+  [[nodiscard]] Shell::Result run_script(const std::string& script,
+      const Path& path,
+      const Config::Command& command,
+      bool print_result) const;
+  [[nodiscard]] static bool is_traced(const Config::Command& command);
+  [[nodiscard]] Process::Limits get_limits(const Config::Command& command) const;
+  void replay_result(
+      const Shell::Result& result, const std::string& command_path, bool print_result);
+
+  [[nodiscard]] Scripts parse_scripts(const Config::Command& command);
   [[nodiscard]] std::string parse_script(
       const std::string& script, const Config::Location& location);
 
   [[nodiscard]] static enum Variable::Type get_variable_type(
       const std::shared_ptr<Config::Parameter>& param);
 
-  void validate_required_parameters(const std::shared_ptr<Config::Command>& command);
+  void validate_required_parameters(const Config::Command& command);
   [[nodiscard]] bool is_variable_defined(const std::string& name) const;
   void handle_error(const Error::BaseError& error);
 
   static void print(const std::string& message);
+  static void print_skipped(const std::string& command_path, const std::string& dir, size_t count);
+  static void print_unchanged(const std::string& command_path, const std::string& dir);
+  static void print_lock_status(
+      const std::string& command_path, const std::string& dir, const std::string& message);
+  static void print_perf_counters(const std::string& command_path,
+      const std::string& dir,
+      const Debug::PerfCounter::Values& values);
 
   const std::shared_ptr<Instruction>& m_instruction;
   const Config::Query m_query;
+  const Options m_options;
+  ExecutionHook m_execution_hook{};
+  Path m_default_directory{};
+  Shell::ExecCallback m_output{};
+  CancelCheck m_cancel_check{};
+  std::shared_ptr<Journal> m_journal{};
+  std::shared_ptr<Resources> m_resources{};
+  Throttle* m_throttle{nullptr};
+  const OutputCache m_output_cache{};
+  const TracedInputs m_traced_inputs{};
+
+  // Directories of wildcard patterns, only looked up once for every pattern per execution.
+  std::unordered_map<std::string, std::vector<std::string>> m_expanded_directories{};
+  std::set<std::string> m_used_directories{};
+  // Read with `--affected` unless set, shared by every interpreter asking for the same one.
+  std::shared_ptr<const Changes> m_changes{};
 
   size_t m_offset{0};
   std::string m_current_variable_name{};
   bool m_stop_execution{false};
+  bool m_cancelled{false};
 
   // Initialize with empty scope
   std::vector<Variables> m_scope{Variables()};
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Journal.hpp"
+
+#include <fmt/format.h>
+
+#include <deque>
+#include <filesystem>
+#include <string_view>
+#include <system_error>
+
+#include "Core/CLI/Options.hpp"
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/Environment.hpp"
+#include "Core/Log.hpp"
+#include "Core/MappedFile.hpp"
+#include "Core/Utils.hpp"
+
+namespace Litr::CLI {
+
+Journal::Journal(const std::shared_ptr<Instruction>& instruction,
+    const std::shared_ptr<Config::Loader>& config,
+    bool resume)
+    : m_file_path(Environment::get_cache_directory().append(
+          fmt::format("journal/{}", Utils::to_hex(create_key(instruction, config))))) {
+  LITR_PROFILE_FUNCTION();
+
+  if (resume) {
+    read_steps();
+  } else {
+    remove();
+  }
+}
+
+Journal::Step Journal::create_step(
+    const std::string& command_path, const std::string& dir, const std::string& script) {
+  LITR_PROFILE_FUNCTION();
+
+  const uint64_t hash{Utils::hash(fmt::format("{}\n{}\n{}", command_path, dir, script))};
+  const Step step{Utils::to_hex(hash)};
+  const size_t occurrence{m_occurrences[step]++};
+
+  return occurrence == 0 ? step : Utils::to_hex(Utils::hash(std::to_string(occurrence), hash));
+}
+
+bool Journal::is_done(const Step& step) const {
+  LITR_PROFILE_FUNCTION();
+
+  return m_done.find(step) != m_done.end();
+}
+
+void Journal::mark_done(const Step& step) {
+  LITR_PROFILE_FUNCTION();
+
+  if (m_file == nullptr) {
+    std::error_code error{};
+    std::filesystem::create_directories(m_file_path.without_filename().to_string(), error);
+    m_file = std::make_unique<AppendFile>(m_file_path);
+  }
+
+  // A journal that cannot be written only means there is nothing to resume later on.
+  if (!m_file->append(step + '\n')) {
+    LITR_CORE_TRACE("Could not write to the journal {}", m_file_path);
+  }
+  m_done.insert(step);
+}
+
+void Journal::remove() {
+  LITR_PROFILE_FUNCTION();
+
+  m_file.reset();
+  m_done.clear();
+
+  std::error_code error{};
+  std::filesystem::remove(m_file_path.to_string(), error);
+}
+
+bool Journal::has_steps() const {
+  LITR_PROFILE_FUNCTION();
+
+  return !m_done.empty();
+}
+
+uint64_t Journal::create_key(const std::shared_ptr<Instruction>& instruction,
+    const std::shared_ptr<Config::Loader>& config) {
+  LITR_PROFILE_FUNCTION();
+
+  uint64_t key{Utils::hash(FileSystem::get_current_working_directory().to_string())};
+  size_t offset{0};
+
+  while (offset < instruction->count()) {
+    const auto code{static_cast<Instruction::Code>(instruction->read(offset++))};
+
+    if (code == Instruction::Code::CLEAR) {
+      key = Utils::hash(fmt::format("{}\n", static_cast<int>(code)), key);
+      continue;
+    }
+
+    const Instruction::Value value{instruction->read_constant(instruction->read_operand(offset))};
+
+    // Built-in options change how commands run, not what they do, e.g. `--resume` itself.
+    if (code == Instruction::Code::DEFINE && Options::is_builtin(value)) {
+      if (offset < instruction->count() &&
+          static_cast<Instruction::Code>(instruction->read(offset)) ==
+              Instruction::Code::CONSTANT) {
+        ++offset;
+        static_cast<void>(instruction->read_operand(offset));
+      }
+      continue;
+    }
+
+    key = Utils::hash(fmt::format("{}\n{}\n", static_cast<int>(code), value), key);
+  }
+
+  for (auto&& file_path : config->get_file_paths()) {
+    const MappedFile file{file_path};
+    key = Utils::hash(file.get_contents(), Utils::hash(file_path.to_string(), key));
+  }
+
+  return key;
+}
+
+void Journal::read_steps() {
+  LITR_PROFILE_FUNCTION();
+
+  const MappedFile file{m_file_path};
+  if (!file.is_open()) {
+    return;
+  }
+
+  std::deque<std::string_view> lines{};
+  Utils::split_into(file.get_contents(), '\n', lines);
+
+  // The last line can be cut off, if the process got killed while writing it.
+  constexpr size_t step_length{16};
+  for (auto&& line : lines) {
+    if (line.size() == step_length) {
+      m_done.emplace(line);
+    }
+  }
+
+  LITR_CORE_TRACE("Resume with {} steps done from {}", m_done.size(), m_file_path);
+}
+
+}  // namespace Litr::CLI
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Core/AppendFile.hpp"
+#include "Core/CLI/Instruction.hpp"
+#include "Core/Config/Loader.hpp"
+#include "Core/FileSystem.hpp"
+
+namespace Litr::CLI {
+
+// Remembers the steps of an invocation that are done, every script in each of its
+// directories. A failed invocation can be resumed where it stopped, as long as the
+// instructions, their parameters and the configuration stay the same. Every step is
+// appended to the journal file right away, so it survives the process being killed.
+class Journal {
+ public:
+  using Step = std::string;
+
+  // Without resuming, the steps of an earlier invocation are forgotten.
+  Journal(const std::shared_ptr<Instruction>& instruction,
+      const std::shared_ptr<Config::Loader>& config,
+      bool resume);
+
+  // A step is what runs where, and how often the same ran before in this invocation,
+  // so a command called twice is still two steps.
+  [[nodiscard]] Step create_step(
+      const std::string& command_path, const std::string& dir, const std::string& script);
+  [[nodiscard]] bool is_done(const Step& step) const;
+  void mark_done(const Step& step);
+
+  // Nothing is left to resume once an invocation finished.
+  void remove();
+
+  [[nodiscard]] bool has_steps() const;
+  [[nodiscard]] inline const Path& get_file_path() const {
+    return m_file_path;
+  }
+
+  // Everything a step depends on, besides the step itself.
+  [[nodiscard]] static uint64_t create_key(const std::shared_ptr<Instruction>& instruction,
+      const std::shared_ptr<Config::Loader>& config);
+
+ private:
+  void read_steps();
+
+  const Path m_file_path;
+  std::unordered_set<Step> m_done{};
+  std::unordered_map<Step, size_t> m_occurrences{};
+
+  // Only created once the first step is done.
+  std::unique_ptr<AppendFile> m_file{};
+};
+
+}  // namespace Litr::CLI
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Options.hpp"
+
+#include <algorithm>
+
+#include "Core/Debug/Instrumentor.hpp"
+
+namespace Litr::CLI {
+
+Options::Options(const std::shared_ptr<Instruction>& instruction) {
+  LITR_PROFILE_FUNCTION();
+
+  size_t offset{0};
+
+  while (offset < instruction->count()) {
+    const auto code{static_cast<Instruction::Code>(instruction->read(offset++))};
+
+    if (code == Instruction::Code::CLEAR) {
+      continue;
+    }
+
+    const Instruction::Value name{instruction->read_constant(instruction->read_operand(offset))};
+    if (code != Instruction::Code::DEFINE || !is_builtin(name)) {
+      continue;
+    }
+
+    std::string value{};
+    if (offset < instruction->count() &&
+        static_cast<Instruction::Code>(instruction->read(offset)) == Instruction::Code::CONSTANT) {
+      ++offset;
+      value = instruction->read_constant(instruction->read_operand(offset));
+    }
+
+    m_values.insert_or_assign(std::string{name}, value);
+  }
+}
+
+bool Options::has(const std::string& name) const {
+  LITR_PROFILE_FUNCTION();
+
+  return m_values.find(name) != m_values.end();
+}
+
+std::string Options::get(const std::string& name) const {
+  LITR_PROFILE_FUNCTION();
+
+  const auto value{m_values.find(name)};
+  if (value == m_values.end()) {
+    return "";
+  }
+
+  return value->second;
+}
+
+const Options::Definitions& Options::get_definitions() {
+  static const Definitions definitions{
+      {{"perf", "", "Report performance counters for every executed script."},
+          {"bench", "=<runs>", "Run commands repeatedly and report timing statistics."},
+          {"warmup", "=<runs>", "Number of untimed runs before a benchmark."},
+          {"validate", "", "Check the whole configuration, not only the commands used."},
+          {"workspace", "", "Run commands in every package with a configuration file."},
+          {"jobs", "=<count>", "Packages running scripts at once, `auto` to follow the load."},
+          {"affected", "[=<ref>]", "Only run directories changed since a git reference."},
+          {"no-ignore", "", "Let `dir` patterns match directories `.gitignore` excludes."},
+          {"watch", "", "Run commands again for every directory with changed files."},
+          {"resume", "", "Skip scripts a failed run of the same commands already did."},
+          {"timeout", "=<duration>", "Stop scripts running longer, e.g. `15m` or `1h30m`."}}};
+  return definitions;
+}
+
+bool Options::is_builtin(std::string_view name) {
+  LITR_PROFILE_FUNCTION();
+
+  const Definitions& definitions{get_definitions()};
+  return std::any_of(definitions.begin(), definitions.end(), [&name](const Definition& option) {
+    return name == option.name;
+  });
+}
+
+}  // namespace Litr::CLI
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "Core/CLI/Instruction.hpp"
+
+namespace Litr::CLI {
+
+// Built-in options are handled by Litr itself and never reach the configured
+// parameters, e.g. `--perf` to report performance counters for every script.
+class Options {
+ public:
+  struct Definition {
+    const char* name;
+    const char* argument;
+    const char* description;
+  };
+
+  using Definitions = std::array<Definition, 11>;
+
+  explicit Options(const std::shared_ptr<Instruction>& instruction);
+
+  [[nodiscard]] bool has(const std::string& name) const;
+  [[nodiscard]] std::string get(const std::string& name) const;
+
+  [[nodiscard]] static const Definitions& get_definitions();
+  [[nodiscard]] static bool is_builtin(std::string_view name);
+
+ private:
+  std::unordered_map<std::string, std::string> m_values{};
+};
+
+}  // namespace Litr::CLI
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "OutputCache.hpp"
+
+#include <fmt/format.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+#include "Core/CLI/ResultFile.hpp"
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/Environment.hpp"
+#include "Core/Log.hpp"
+#include "Core/Utils.hpp"
+
+namespace Litr::CLI {
+
+OutputCache::OutputCache()
+    : OutputCache(Environment::get_cache_directory().append(std::string{"output"})) {}
+
+OutputCache::OutputCache(Path directory) : m_directory(std::move(directory)) {}
+
+uint64_t OutputCache::create_key(
+    const std::string& script, const Path& path, Span<const std::string_view> variables) {
+  LITR_PROFILE_FUNCTION();
+
+  // Scripts without a directory run in the current one.
+  const Path directory{FileSystem::get_absolute_path(path)};
+
+  uint64_t key{Utils::hash(fmt::format("{}\n{}\n", script, directory.to_string()))};
+
+  for (auto&& variable : variables) {
+    // std::getenv is not thread safe, but this will not be a problem here.
+    // NOLINTNEXTLINE(concurrency-mt-unsafe)
+    const char* value{std::getenv(std::string{variable}.c_str())};
+    key = Utils::hash(fmt::format("{}={}\n", variable, value != nullptr ? value : ""), key);
+  }
+
+  return key;
+}
+
+std::optional<Shell::Result> OutputCache::get(uint64_t key, std::chrono::seconds ttl) const {
+  LITR_PROFILE_FUNCTION();
+
+  std::optional<ResultFile> file{ResultFile::read(get_file_path(key))};
+  if (!file.has_value() || file->key != key) {
+    return std::nullopt;
+  }
+
+  const auto age{ResultFile::Clock::now() - file->created};
+  if (age < ResultFile::Clock::duration::zero() || age >= ttl) {
+    return std::nullopt;
+  }
+
+  LITR_CORE_TRACE("Output cache hit for {}", Utils::to_hex(key));
+  return std::move(file->result);
+}
+
+void OutputCache::set(uint64_t key, const Shell::Result& result) const {
+  LITR_PROFILE_FUNCTION();
+
+  std::error_code error{};
+  std::filesystem::create_directories(m_directory.to_string(), error);
+
+  static_cast<void>(ResultFile::write(get_file_path(key), result, key));
+}
+
+Path OutputCache::get_file_path(uint64_t key) const {
+  LITR_PROFILE_FUNCTION();
+
+  return m_directory.append(Utils::to_hex(key));
+}
+
+}  // namespace Litr::CLI
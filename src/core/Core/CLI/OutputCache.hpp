@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "Core/CLI/Shell.hpp"
+#include "Core/FileSystem.hpp"
+#include "Core/Span.hpp"
+
+namespace Litr::CLI {
+
+// Output of scripts kept between runs, for commands only computing a value, e.g. a
+// toolchain version probe. Every entry is a file in the cache directory, named after a
+// hash of everything the output depends on.
+class OutputCache {
+ public:
+  OutputCache();
+  explicit OutputCache(Path directory);
+
+  // The script as it runs, the directory it runs in and the values of the given
+  // environment variables.
+  [[nodiscard]] static uint64_t create_key(
+      const std::string& script, const Path& path, Span<const std::string_view> variables);
+
+  // Nothing if there is no entry or it is older than the time to live.
+  [[nodiscard]] std::optional<Shell::Result> get(uint64_t key, std::chrono::seconds ttl) const;
+  void set(uint64_t key, const Shell::Result& result) const;
+
+ private:
+  [[nodiscard]] Path get_file_path(uint64_t key) const;
+
+  const Path m_directory;
+};
+
+}  // namespace Litr::CLI
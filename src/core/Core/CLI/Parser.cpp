@@ -5,6 +5,7 @@
 #include "Parser.hpp"
 
 #include "Core/CLI/Scanner.hpp"
+#include "Core/Debug/AllocationTracker.hpp"
 #include "Core/Debug/Disassembler.hpp"
 #include "Core/Debug/Instrumentor.hpp"
 #include "Core/Error/Handler.hpp"
@@ -12,11 +13,48 @@
 
 namespace Litr::CLI {
 
+/** @private */
+static std::string join_arguments(const std::vector<std::string>& arguments) {
+  LITR_PROFILE_FUNCTION();
+
+  // Only used to show the arguments in error messages, parsing happens on the arguments.
+  size_t length{0};
+  for (auto&& argument : arguments) {
+    length += argument.size() + 1;
+  }
+
+  std::string source{};
+  source.reserve(length);
+  for (auto&& argument : arguments) {
+    source.append(" ").append(argument);
+  }
+
+  return source;
+}
+
 Parser::Parser(const std::shared_ptr<Instruction>& instruction, const std::string& source)
     : m_source(source),
       m_scanner(source.c_str()),
       m_instruction(instruction) {
   LITR_PROFILE_FUNCTION();
+  LITR_ALLOCATION_PHASE(CLI_PARSE);
+
+  parse();
+}
+
+Parser::Parser(
+    const std::shared_ptr<Instruction>& instruction, const std::vector<std::string>& arguments)
+    : m_source(join_arguments(arguments)),
+      m_scanner(arguments),
+      m_instruction(instruction) {
+  LITR_PROFILE_FUNCTION();
+  LITR_ALLOCATION_PHASE(CLI_PARSE);
+
+  parse();
+}
+
+void Parser::parse() {
+  LITR_PROFILE_FUNCTION();
 
   advance();
   arguments();
@@ -84,11 +122,11 @@ void Parser::emit_byte(const Instruction::Code code) {
   m_instruction->write(code);
 }
 
-void Parser::emit_bytes(const Instruction::Code code, const std::byte byte) {
+void Parser::emit_bytes(const Instruction::Code code, const size_t operand) {
   LITR_PROFILE_FUNCTION();
 
   emit_byte(code);
-  emit_byte(byte);
+  m_instruction->write_operand(operand);
 }
 
 void Parser::emit_constant(const Instruction::Value& value) {
@@ -106,7 +144,7 @@ void Parser::emit_definition(const Instruction::Value& value) {
 void Parser::emit_scope(const Instruction::Value& value) {
   LITR_PROFILE_FUNCTION();
 
-  m_scope.push_back(value);
+  m_scope.emplace_back(value);
   emit_bytes(Instruction::Code::BEGIN_SCOPE, make_constant(value));
 }
 
@@ -124,7 +162,7 @@ void Parser::emit_clear() {
   m_scope.pop_back();
 }
 
-std::byte Parser::make_constant(const Instruction::Value& value) {
+size_t Parser::make_constant(const Instruction::Value& value) {
   LITR_PROFILE_FUNCTION();
 
   return m_instruction->write_constant(value);
@@ -141,7 +179,7 @@ void Parser::arguments() {
     return;
   }
 
-  if (match({TokenType::STRING, TokenType::NUMBER, TokenType::ERROR})) {
+  if (match({TokenType::STRING, TokenType::VALUE, TokenType::NUMBER, TokenType::ERROR})) {
     error("This is not allowed here.");
     return;
   }
@@ -175,6 +213,14 @@ void Parser::parameters() {
 
   if (peak(TokenType::EQUAL)) {
     advance();
+
+    // Values from arguments are already split by the shell and are used unchanged.
+    if (peak(TokenType::VALUE)) {
+      advance();
+      emit_constant(Scanner::get_token_value(m_previous));
+      return;
+    }
+
     consume(TokenType::STRING, "Value assignment missing.");
     emit_constant(Utils::trim(Scanner::get_token_value(m_previous), '"'));
   }
@@ -239,8 +285,8 @@ void Parser::error_at(Token* token, const std::string& message) {
 
   out_message.append(fmt::format(": {}", message));
 
-  Error::Handler::push(
-      Error::CLIParserError(out_message, 1, token->column, Utils::trim(m_source, ' ')));
+  Error::Handler::push(Error::CLIParserError(
+      out_message, 1, token->column, std::string{Utils::trim(m_source, ' ')}));
 
   m_has_error = true;
 }
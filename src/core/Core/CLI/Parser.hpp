@@ -7,6 +7,7 @@
 #include <deque>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "Core/CLI/Instruction.hpp"
 #include "Core/CLI/Scanner.hpp"
@@ -17,17 +18,19 @@ namespace Litr::CLI {
 class Parser {
  public:
   Parser(const std::shared_ptr<Instruction>& instruction, const std::string& source);
+  Parser(
+      const std::shared_ptr<Instruction>& instruction, const std::vector<std::string>& arguments);
 
   void advance();
   void consume(TokenType type, const char* message);
   [[nodiscard]] bool match(TokenType type) const;
   [[nodiscard]] bool match(std::initializer_list<TokenType> types) const;
   [[nodiscard]] bool peak(TokenType type) const;
-  std::byte make_constant(const Instruction::Value& value);
+  size_t make_constant(const Instruction::Value& value);
 
   void emit_byte(std::byte byte);
   void emit_byte(Instruction::Code code);
-  void emit_bytes(Instruction::Code code, std::byte byte);
+  void emit_bytes(Instruction::Code code, size_t operand);
   void emit_constant(const Instruction::Value& value);
   void emit_definition(const Instruction::Value& value);
   void emit_scope(const Instruction::Value& value);
@@ -45,6 +48,8 @@ class Parser {
   }
 
  private:
+  void parse();
+
   void error(const std::string& message);
   void error_at_current(const std::string& message);
   void error_at(Token* token, const std::string& message);
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Resources.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/Log.hpp"
+
+namespace Litr::CLI {
+
+Resources::Lease::Lease(Resources* resources, Demand demand)
+    : m_resources(resources),
+      m_demand(demand) {
+  if (m_resources != nullptr) {
+    m_resources->acquire(m_demand);
+  }
+}
+
+Resources::Lease::~Lease() {
+  if (m_resources != nullptr) {
+    m_resources->release(m_demand);
+  }
+}
+
+Resources::Resources(Capacities capacities) : m_capacities(std::move(capacities)) {}
+
+void Resources::acquire(Demand demand) {
+  LITR_PROFILE_FUNCTION();
+
+  if (demand.empty()) {
+    return;
+  }
+
+  std::unique_lock lock{m_mutex};
+  if (!is_free(demand)) {
+    LITR_CORE_TRACE("Waiting for resources to be released");
+    m_released.wait(lock, [this, demand]() { return is_free(demand); });
+  }
+
+  for (auto&& resource : demand) {
+    m_used[std::string{resource.name}] += get_amount(resource);
+  }
+}
+
+void Resources::release(Demand demand) {
+  LITR_PROFILE_FUNCTION();
+
+  if (demand.empty()) {
+    return;
+  }
+
+  {
+    std::lock_guard lock{m_mutex};
+    for (auto&& resource : demand) {
+      m_used[std::string{resource.name}] -= get_amount(resource);
+    }
+  }
+
+  m_released.notify_all();
+}
+
+size_t Resources::get_capacity(const std::string& name) const {
+  const auto capacity{m_capacities.find(name)};
+  return capacity != m_capacities.end() ? capacity->second : 1;
+}
+
+size_t Resources::get_amount(const Config::Command::Resource& resource) const {
+  return std::min(resource.amount, get_capacity(std::string{resource.name}));
+}
+
+bool Resources::is_free(Demand demand) const {
+  return std::all_of(demand.begin(), demand.end(), [this](auto&& resource) {
+    const std::string name{resource.name};
+    const auto used{m_used.find(name)};
+    const size_t in_use{used != m_used.end() ? used->second : 0};
+    return in_use + get_amount(resource) <= get_capacity(name);
+  });
+}
+
+}  // namespace Litr::CLI
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "Core/Config/Command.hpp"
+#include "Core/Span.hpp"
+
+namespace Litr::CLI {
+
+// Resources commands running at the same time share, e.g. a database only one test may
+// migrate at once. A command only starts if all of its resources are free.
+class Resources {
+ public:
+  using Capacities = std::unordered_map<std::string, size_t>;
+  using Demand = Span<const Config::Command::Resource>;
+
+  // Holds the resources from its creation on until it is gone, nothing without resources.
+  class Lease {
+   public:
+    Lease(Resources* resources, Demand demand);
+
+    // Neither copy nor move, resources are released exactly once.
+    Lease(const Lease&) = delete;
+    Lease(Lease&&) = delete;
+    Lease& operator=(const Lease&) = delete;
+    Lease& operator=(Lease&&) = delete;
+    ~Lease();
+
+   private:
+    Resources* const m_resources;
+    const Demand m_demand;
+  };
+
+  // A resource without a capacity can only be used by one command at a time.
+  explicit Resources(Capacities capacities);
+
+  // Waits until all resources are free at once, so commands never hold on to a part of
+  // them while waiting for the rest. Demands above a capacity take all of it.
+  void acquire(Demand demand);
+  void release(Demand demand);
+
+ private:
+  [[nodiscard]] size_t get_capacity(const std::string& name) const;
+  [[nodiscard]] size_t get_amount(const Config::Command::Resource& resource) const;
+  [[nodiscard]] bool is_free(Demand demand) const;
+
+  const Capacities m_capacities;
+  std::mutex m_mutex{};
+  std::condition_variable m_released{};
+  // Guarded by the mutex.
+  std::unordered_map<std::string, size_t> m_used{};
+};
+
+}  // namespace Litr::CLI
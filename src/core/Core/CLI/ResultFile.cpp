@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "ResultFile.hpp"
+
+#include <fmt/format.h>
+
+#include <charconv>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/Log.hpp"
+#include "Core/MappedFile.hpp"
+#include "Core/Utils.hpp"
+
+namespace Litr::CLI {
+
+std::optional<ResultFile> ResultFile::read(const Path& path) {
+  LITR_PROFILE_FUNCTION();
+
+  const MappedFile file{path};
+  if (!file.is_open()) {
+    return std::nullopt;
+  }
+
+  const std::string_view contents{file.get_contents()};
+  const std::string_view header{contents.substr(0, contents.find('\n'))};
+  if (header.size() == contents.size()) {
+    return std::nullopt;
+  }
+
+  const char* end{header.data() + header.size()};
+  int status{0};
+  uint64_t key{0};
+  Clock::rep created{0};
+
+  auto parsed{std::from_chars(header.data(), end, status)};
+  if (parsed.ec == std::errc() && parsed.ptr != end) {
+    parsed = std::from_chars(parsed.ptr + 1, end, key, 16);
+  }
+  if (parsed.ec == std::errc() && parsed.ptr != end) {
+    parsed = std::from_chars(parsed.ptr + 1, end, created);
+  }
+  if (parsed.ec != std::errc() || parsed.ptr != end) {
+    return std::nullopt;
+  }
+
+  return ResultFile{
+      Shell::Result{
+          static_cast<ExitStatus>(status), std::string{contents.substr(header.size() + 1)}},
+      key,
+      Clock::time_point{Clock::duration{created}}};
+}
+
+bool ResultFile::write(const Path& path, const Shell::Result& result, uint64_t key) {
+  LITR_PROFILE_FUNCTION();
+
+  const std::string contents{fmt::format("{} {} {}\n{}",
+      static_cast<int>(result.status),
+      Utils::to_hex(key),
+      Clock::now().time_since_epoch().count(),
+      result.message)};
+
+  if (!FileSystem::write_file(path, contents)) {
+    LITR_CORE_TRACE("Could not write result {}", path);
+    return false;
+  }
+
+  return true;
+}
+
+}  // namespace Litr::CLI
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+#include "Core/CLI/Shell.hpp"
+#include "Core/FileSystem.hpp"
+
+namespace Litr::CLI {
+
+// Result of scripts kept in a file, for other invocations or later runs to use instead of
+// running them again. The file starts with a header line of the exit status, the key of what
+// created the result and the time it was created at, the output follows.
+struct ResultFile {
+  using Clock = std::chrono::system_clock;
+
+  Shell::Result result{};
+  uint64_t key{0};
+  Clock::time_point created{};
+
+  // Nothing if there is no file or it is not a result.
+  [[nodiscard]] static std::optional<ResultFile> read(const Path& path);
+  static bool write(const Path& path, const Shell::Result& result, uint64_t key);
+};
+
+}  // namespace Litr::CLI
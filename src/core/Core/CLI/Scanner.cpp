@@ -4,12 +4,26 @@
 
 #include "Scanner.hpp"
 
+#include <cstring>
+
 #include "Core/Debug/Instrumentor.hpp"
 
 namespace Litr::CLI {
 
 Scanner::Scanner(const char* source) : m_start(source), m_current(source) {}
 
+Scanner::Scanner(const std::vector<std::string>& arguments)
+    : m_start(""),
+      m_current(""),
+      m_arguments(arguments.data(), arguments.size()) {
+  if (!m_arguments.empty()) {
+    // Columns are counted as if all arguments were joined, each with a leading space.
+    m_start = m_arguments.front().c_str();
+    m_current = m_start;
+    ++m_column;
+  }
+}
+
 void Scanner::skip_whitespace() {
   LITR_PROFILE_FUNCTION();
 
@@ -22,6 +36,12 @@ void Scanner::skip_whitespace() {
         advance();
         break;
       }
+      case '\0': {
+        if (!next_argument()) {
+          return;
+        }
+        break;
+      }
       default: {
         return;
       }
@@ -29,15 +49,23 @@ void Scanner::skip_whitespace() {
   }
 }
 
-char Scanner::peek() {
+bool Scanner::next_argument() {
   LITR_PROFILE_FUNCTION();
 
+  if (m_argument + 1 >= m_arguments.size()) {
+    return false;
+  }
+
+  m_current = m_arguments[++m_argument].c_str();
+  ++m_column;
+  return true;
+}
+
+char Scanner::peek() {
   return *m_current;
 }
 
 char Scanner::peek_next() const {
-  LITR_PROFILE_FUNCTION();
-
   if (is_at_end()) {
     return '\0';
   }
@@ -46,16 +74,12 @@ char Scanner::peek_next() const {
 }
 
 char Scanner::advance() {
-  LITR_PROFILE_FUNCTION();
-
   ++m_current;
   ++m_column;
   return m_current[-1];
 }
 
 bool Scanner::match(const char expected) {
-  LITR_PROFILE_FUNCTION();
-
   if (is_at_end()) {
     return false;
   }
@@ -72,6 +96,13 @@ bool Scanner::match(const char expected) {
 Token Scanner::scan_token() {
   LITR_PROFILE_FUNCTION();
 
+  // A value belongs to the argument of its parameter, even if empty or starting with spaces.
+  if (m_expect_value) {
+    m_expect_value = false;
+    m_start = m_current;
+    return value();
+  }
+
   skip_whitespace();
 
   m_start = m_current;
@@ -94,6 +125,7 @@ Token Scanner::scan_token() {
     case ',':
       return make_token(TokenType::COMMA);
     case '=':
+      m_expect_value = !m_arguments.empty();
       return make_token(TokenType::EQUAL);
     case '-':
       return match('-') ? long_parameter() : short_parameter();
@@ -104,28 +136,20 @@ Token Scanner::scan_token() {
   }
 }
 
-std::string Scanner::get_token_value(const Token& token) {
-  LITR_PROFILE_FUNCTION();
-
+std::string_view Scanner::get_token_value(const Token& token) {
   return {token.start, token.length};
 }
 
-std::string Scanner::get_token_value(Token* token) {
-  LITR_PROFILE_FUNCTION();
-
+std::string_view Scanner::get_token_value(Token* token) {
   return {token->start, token->length};
 }
 
 Token Scanner::make_token(const TokenType type) const {
-  LITR_PROFILE_FUNCTION();
-
   Token token{type, m_start, static_cast<size_t>(m_current - m_start), m_column};
   return token;
 }
 
 Token Scanner::error_token(const char* message) const {
-  LITR_PROFILE_FUNCTION();
-
   Token token{TokenType::ERROR, message, strlen(message), m_column};
   return token;
 }
@@ -171,6 +195,16 @@ Token Scanner::string() {
   return make_token(TokenType::STRING);
 }
 
+Token Scanner::value() {
+  LITR_PROFILE_FUNCTION();
+
+  const size_t length{std::strlen(m_current)};
+  m_current += length;
+  m_column += static_cast<uint32_t>(length);
+
+  return make_token(TokenType::VALUE);
+}
+
 Token Scanner::number() {
   LITR_PROFILE_FUNCTION();
 
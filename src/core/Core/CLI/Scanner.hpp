@@ -5,21 +5,28 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "Core/CLI/Token.hpp"
+#include "Core/Span.hpp"
 
 namespace Litr::CLI {
 
 class Scanner {
  public:
   explicit Scanner(const char* source);
+  // Scans arguments as given by the shell. Every argument is separated like by a space,
+  // and a value assigned with `=` is the rest of its argument, without any quoting.
+  explicit Scanner(const std::vector<std::string>& arguments);
 
   [[nodiscard]] Token scan_token();
-  [[nodiscard]] static std::string get_token_value(const Token& token);
-  [[nodiscard]] static std::string get_token_value(Token* token);
+  [[nodiscard]] static std::string_view get_token_value(const Token& token);
+  [[nodiscard]] static std::string_view get_token_value(Token* token);
 
  private:
   void skip_whitespace();
+  [[nodiscard]] bool next_argument();
   char advance();
   char peek();
   [[nodiscard]] char peek_next() const;
@@ -36,6 +43,7 @@ class Scanner {
   [[nodiscard]] bool is_at_end() const;
 
   [[nodiscard]] Token string();
+  [[nodiscard]] Token value();
   [[nodiscard]] Token number();
   [[nodiscard]] Token command();
   [[nodiscard]] Token long_parameter();
@@ -44,6 +52,10 @@ class Scanner {
   const char* m_start;
   const char* m_current;
   uint32_t m_column{1};
+
+  Span<const std::string> m_arguments{};
+  size_t m_argument{0};
+  bool m_expect_value{false};
 };
 
 }  // namespace Litr::CLI
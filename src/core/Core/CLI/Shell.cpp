@@ -5,9 +5,11 @@
 #include "Shell.hpp"
 
 #include <cstdio>
+#include <utility>
 
 #include "Core/Debug/Instrumentor.hpp"
 #include "Core/Log.hpp"
+#include "Core/ProcessTracer.hpp"
 
 namespace Litr::CLI {
 
@@ -27,16 +29,57 @@ Shell::Result Shell::exec(
     const std::string& command, const Path& path, const Shell::ExecCallback& callback) {
   LITR_PROFILE_FUNCTION();
 
+  return Shell::exec(command, path, callback, Process::Limits{});
+}
+
+Shell::Result Shell::exec(const std::string& command,
+    const Path& path,
+    const Shell::ExecCallback& callback,
+    const Process::Limits& limits,
+    const Process::CancelCheck& cancel_check) {
+  LITR_PROFILE_FUNCTION();
+
   Result result{};
   std::string cmd{create_command_string(command, path)};
 
   LITR_CORE_TRACE("Executing command \"{}\"", cmd);
 
+  if ((!limits.empty() || cancel_check) && Process::is_supported()) {
+    const Process::Result process{Process::run(
+        cmd,
+        limits,
+        [&result, &callback](const std::string& output) {
+          result.message.append(output);
+          callback(output);
+        },
+        cancel_check)};
+    result.status = get_exit_status(process.exit_code);
+    result.timed_out = process.timed_out;
+    result.cancelled = process.cancelled;
+    return result;
+  }
+
+  return read_stream(cmd, callback);
+}
+
+Shell::Result Shell::read(const std::string& command) {
+  LITR_PROFILE_FUNCTION();
+
+  LITR_CORE_TRACE("Reading output of command \"{}\"", command);
+
+  return read_stream(command, []([[maybe_unused]] const std::string& _buffer) {});
+}
+
+Shell::Result Shell::read_stream(const std::string& command, const Shell::ExecCallback& callback) {
+  LITR_PROFILE_FUNCTION();
+
+  Result result{};
+
   // @todo: So, this whole part won't be linted, because everything is screaming, for
   // very good reasons as well. So, this needs some love here and maybe a better way
   // to execute a command on the default shell.
   // NOLINTNEXTLINE
-  FILE* stream{popen(cmd.c_str(), "r")};
+  FILE* stream{popen(command.c_str(), "r")};
 
   if (stream) {  // NOLINT
     constexpr int max_buffer{256};
@@ -55,9 +98,43 @@ Shell::Result Shell::exec(
   return result;
 }
 
+Shell::Trace Shell::trace(const std::string& command,
+    const Path& path,
+    const Shell::ExecCallback& callback,
+    const Process::Limits& limits,
+    const Process::CancelCheck& cancel_check) {
+  LITR_PROFILE_FUNCTION();
+
+  Trace trace{};
+  std::string cmd{create_command_string(command, path)};
+
+  LITR_CORE_TRACE("Tracing command \"{}\"", cmd);
+
+  ProcessTracer::Result result{ProcessTracer::run(
+      cmd,
+      limits,
+      [&trace, &callback](const std::string& output) {
+        trace.result.message.append(output);
+        callback(output);
+      },
+      cancel_check)};
+
+  trace.result.status = get_exit_status(result.exit_code);
+  trace.result.timed_out = result.timed_out;
+  trace.result.cancelled = result.cancelled;
+  trace.files = std::move(result.files);
+
+  return trace;
+}
+
 ExitStatus Shell::get_status_code(const int stream_status) {
   constexpr int status_base{256};
-  return static_cast<ExitStatus>(stream_status / status_base);
+  return get_exit_status(stream_status / status_base);
+}
+
+ExitStatus Shell::get_exit_status(const int exit_code) {
+  // Any code but zero is a failure, e.g. 126 for a process that could not be started.
+  return exit_code == 0 ? ExitStatus::SUCCESS : ExitStatus::FAILURE;
 }
 
 std::string Shell::create_command_string(const std::string& command, const Path& path) {
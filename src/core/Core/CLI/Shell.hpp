@@ -6,9 +6,11 @@
 
 #include <functional>
 #include <string>
+#include <vector>
 
 #include "Core/ExitStatus.hpp"
 #include "Core/FileSystem.hpp"
+#include "Core/Process.hpp"
 
 namespace Litr::CLI {
 
@@ -17,6 +19,15 @@ class Shell {
   struct Result {
     ExitStatus status{ExitStatus::SUCCESS};
     std::string message{};
+    // Ended because it ran longer than its timeout, see `Process::Limits`.
+    bool timed_out{false};
+    // Ended because the cancel check told so.
+    bool cancelled{false};
+  };
+
+  struct Trace {
+    Result result{};
+    std::vector<std::string> files{};
   };
 
   using ExecCallback = std::function<void(const std::string&)>;
@@ -25,9 +36,28 @@ class Shell {
   static Result exec(const std::string& command, const Shell::ExecCallback& callback);
   static Result exec(
       const std::string& command, const Path& path, const Shell::ExecCallback& callback);
+  // Limits only apply where processes can be started with them, see `Process`. The same
+  // goes for cancelling the command while it runs.
+  static Result exec(const std::string& command,
+      const Path& path,
+      const Shell::ExecCallback& callback,
+      const Process::Limits& limits,
+      const Process::CancelCheck& cancel_check = {});
+  // Runs the command in the current directory and keeps only what it writes to standard
+  // output, errors are not mixed into the result.
+  static Result read(const std::string& command);
+  // Same as `exec`, but also tells which files the command and its processes used.
+  static Trace trace(const std::string& command,
+      const Path& path,
+      const Shell::ExecCallback& callback,
+      const Process::Limits& limits,
+      const Process::CancelCheck& cancel_check = {});
 
  private:
+  [[nodiscard]] static Result read_stream(
+      const std::string& command, const Shell::ExecCallback& callback);
   [[nodiscard]] static ExitStatus get_status_code(int stream_status);
+  [[nodiscard]] static ExitStatus get_exit_status(int exit_code);
   [[nodiscard]] static std::string create_command_string(
       const std::string& command, const Path& path);
   [[nodiscard]] static std::string create_cd_command(const Path& path);
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Throttle.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <utility>
+
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/Log.hpp"
+
+namespace Litr::CLI {
+
+/** @private */
+static constexpr std::chrono::seconds sample_interval{2};
+
+// Pressure in percent of time stalled, memory in percent of all there is.
+/** @private */
+static constexpr double memory_pressure_high{10};
+/** @private */
+static constexpr double memory_pressure_low{1};
+/** @private */
+static constexpr double memory_available_low{10};
+/** @private */
+static constexpr double memory_available_high{20};
+/** @private */
+static constexpr double busy_pressure_high{60};
+/** @private */
+static constexpr double busy_pressure_low{20};
+/** @private */
+static constexpr double overload_factor{1.5};
+
+/** @private */
+static std::optional<double> get_memory_available(const SystemLoad::Sample& sample) {
+  if (!sample.memory_available.has_value() || !sample.memory_total.has_value() ||
+      *sample.memory_total == 0) {
+    return std::nullopt;
+  }
+
+  constexpr double percent{100};
+  return percent * static_cast<double>(*sample.memory_available) /
+         static_cast<double>(*sample.memory_total);
+}
+
+/** @private */
+static bool is_above(const std::optional<double>& value, double threshold) {
+  return value.has_value() && *value >= threshold;
+}
+
+/** @private */
+static bool is_below(const std::optional<double>& value, double threshold) {
+  return !value.has_value() || *value < threshold;
+}
+
+Throttle::Slot::Slot(Throttle* throttle) : m_throttle(throttle) {
+  if (m_throttle != nullptr) {
+    m_throttle->acquire();
+  }
+}
+
+Throttle::Slot::~Slot() {
+  if (m_throttle != nullptr) {
+    m_throttle->release();
+  }
+}
+
+Throttle::Throttle(size_t min_jobs, size_t max_jobs, Report report)
+    : Throttle(min_jobs, max_jobs, std::thread::hardware_concurrency(), std::move(report)) {}
+
+Throttle::Throttle(size_t min_jobs, size_t max_jobs, size_t cores, Report report)
+    : m_min_jobs(std::max<size_t>(min_jobs, 1)),
+      m_max_jobs(std::max(max_jobs, m_min_jobs)),
+      m_cores(std::max<size_t>(cores, 1)),
+      m_report(std::move(report)) {
+  LITR_PROFILE_FUNCTION();
+
+  m_sampled = Clock::now();
+  change_limit(decide_initial(SystemLoad::read()));
+}
+
+void Throttle::acquire() {
+  LITR_PROFILE_FUNCTION();
+
+  std::unique_lock lock{m_mutex};
+  adjust();
+
+  // Waiting tasks look at the load again, a limit lowered before can only rise this way.
+  while (m_running >= m_limit) {
+    m_changed.wait_for(lock, sample_interval);
+    adjust();
+  }
+
+  ++m_running;
+}
+
+void Throttle::release() {
+  LITR_PROFILE_FUNCTION();
+
+  {
+    std::lock_guard lock{m_mutex};
+    --m_running;
+  }
+
+  m_changed.notify_all();
+}
+
+size_t Throttle::get_limit() {
+  std::lock_guard lock{m_mutex};
+  return m_limit;
+}
+
+Throttle::Decision Throttle::decide(size_t limit, const SystemLoad::Sample& sample) const {
+  LITR_PROFILE_FUNCTION();
+
+  const std::optional<double> memory_available{get_memory_available(sample)};
+  const double cores{static_cast<double>(m_cores)};
+
+  // Running out of memory ends in tasks getting killed, which is worse than running slow.
+  if (is_above(sample.memory_pressure, memory_pressure_high)) {
+    return {std::max(limit / 2, m_min_jobs),
+        fmt::format("memory pressure at {:.1f}%", *sample.memory_pressure)};
+  }
+  if (memory_available.has_value() && *memory_available < memory_available_low) {
+    return {std::max(limit / 2, m_min_jobs),
+        fmt::format("only {:.1f}% of memory available", *memory_available)};
+  }
+
+  if (is_above(sample.cpu_pressure, busy_pressure_high)) {
+    return {std::max(limit - 1, m_min_jobs),
+        fmt::format("CPU pressure at {:.1f}%", *sample.cpu_pressure)};
+  }
+  if (is_above(sample.io_pressure, busy_pressure_high)) {
+    return {std::max(limit - 1, m_min_jobs),
+        fmt::format("IO pressure at {:.1f}%", *sample.io_pressure)};
+  }
+  if (is_above(sample.load_average, cores * overload_factor)) {
+    return {std::max(limit - 1, m_min_jobs),
+        fmt::format("load average at {:.2f} on {} cores", *sample.load_average, m_cores)};
+  }
+
+  const bool is_calm{is_below(sample.memory_pressure, memory_pressure_low) &&
+                     is_below(sample.cpu_pressure, busy_pressure_low) &&
+                     is_below(sample.io_pressure, busy_pressure_low) &&
+                     is_below(sample.load_average, cores - 1) &&
+                     (!memory_available.has_value() || *memory_available >= memory_available_high)};
+  const bool is_known{sample.load_average.has_value() || sample.cpu_pressure.has_value()};
+
+  if (is_known && is_calm && limit < m_max_jobs) {
+    return {limit + 1, "machine has room for more"};
+  }
+
+  return {std::clamp(limit, m_min_jobs, m_max_jobs), ""};
+}
+
+Throttle::Decision Throttle::decide_initial(const SystemLoad::Sample& sample) const {
+  LITR_PROFILE_FUNCTION();
+
+  size_t limit{m_max_jobs};
+  std::string reason{"load of the machine unknown"};
+
+  if (sample.load_average.has_value()) {
+    const double busy{std::round(*sample.load_average)};
+    const size_t free{busy < static_cast<double>(m_cores) ? m_cores - static_cast<size_t>(busy)
+                                                          : 0};
+    limit = std::clamp(free, m_min_jobs, m_max_jobs);
+    reason = fmt::format("{} of {} cores free", free, m_cores);
+  }
+
+  // A calm machine is no reason to start with more than the cores free.
+  const Decision decision{decide(limit, sample)};
+  return decision.limit < limit ? decision : Decision{limit, reason};
+}
+
+void Throttle::adjust() {
+  LITR_PROFILE_FUNCTION();
+
+  const Clock::time_point now{Clock::now()};
+  if (now - m_sampled < sample_interval) {
+    return;
+  }
+
+  m_sampled = now;
+  const Decision decision{decide(m_limit, SystemLoad::read())};
+  if (decision.limit != m_limit) {
+    change_limit(decision);
+  }
+}
+
+void Throttle::change_limit(const Decision& decision) {
+  const size_t from{m_limit};
+  m_limit = decision.limit;
+  LITR_CORE_TRACE("Concurrency limit {} to {}: {}", from, m_limit, decision.reason);
+
+  if (m_report) {
+    m_report(from, decision);
+  }
+
+  m_changed.notify_all();
+}
+
+}  // namespace Litr::CLI
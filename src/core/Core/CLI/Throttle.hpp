@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+
+#include "Core/SystemLoad.hpp"
+
+namespace Litr::CLI {
+
+// Limits how many tasks run at the same time by how busy the machine is, within fixed
+// bounds. The load is looked at again every few seconds while tasks start or wait. Memory
+// running out halves the limit, a busy processor or disk lowers it by one, and a calm
+// machine raises it by one.
+class Throttle {
+ public:
+  struct Decision {
+    size_t limit{0};
+    // Why the limit changed, empty if it did not.
+    std::string reason{};
+  };
+
+  using Report = std::function<void(size_t from, const Decision& decision)>;
+
+  // Holds a place from its creation on until it is gone, nothing without a throttle.
+  class Slot {
+   public:
+    explicit Slot(Throttle* throttle);
+
+    // Neither copy nor move, places are given back exactly once.
+    Slot(const Slot&) = delete;
+    Slot(Slot&&) = delete;
+    Slot& operator=(const Slot&) = delete;
+    Slot& operator=(Slot&&) = delete;
+    ~Slot();
+
+   private:
+    Throttle* const m_throttle;
+  };
+
+  // Every change of the limit is reported, the first one as well. Without a number of
+  // cores the ones of this machine are taken.
+  Throttle(size_t min_jobs, size_t max_jobs, Report report);
+  Throttle(size_t min_jobs, size_t max_jobs, size_t cores, Report report);
+
+  void acquire();
+  void release();
+
+  [[nodiscard]] size_t get_limit();
+
+  // The limit to go on with, knowing nothing of the machine changes nothing.
+  [[nodiscard]] Decision decide(size_t limit, const SystemLoad::Sample& sample) const;
+  // A first limit leaving cores to what already runs on the machine.
+  [[nodiscard]] Decision decide_initial(const SystemLoad::Sample& sample) const;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  void adjust();
+  void change_limit(const Decision& decision);
+
+  const size_t m_min_jobs;
+  const size_t m_max_jobs;
+  const size_t m_cores;
+  const Report m_report;
+
+  std::mutex m_mutex{};
+  std::condition_variable m_changed{};
+  // Guarded by the mutex.
+  size_t m_limit{0};
+  size_t m_running{0};
+  Clock::time_point m_sampled{};
+};
+
+}  // namespace Litr::CLI
@@ -13,6 +13,7 @@ enum class TokenType {
   SHORT_PARAMETER,
   LONG_PARAMETER,
   STRING,
+  VALUE,  // Parameter value taken as is from an argument
   NUMBER,
   ERROR,
   EOS  // End of string
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "TracedInputs.hpp"
+
+#include <fmt/format.h>
+
+#include <deque>
+#include <filesystem>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/Environment.hpp"
+#include "Core/Log.hpp"
+#include "Core/MappedFile.hpp"
+#include "Core/Utils.hpp"
+
+namespace Litr::CLI {
+
+TracedInputs::TracedInputs()
+    : TracedInputs(Environment::get_cache_directory().append(std::string{"inputs"})) {}
+
+TracedInputs::TracedInputs(Path directory) : m_directory(std::move(directory)) {}
+
+bool TracedInputs::is_unchanged(uint64_t key) const {
+  LITR_PROFILE_FUNCTION();
+
+  const MappedFile file{get_file_path(key)};
+  if (!file.is_open()) {
+    return false;
+  }
+
+  // Every line is the state of a file followed by its path.
+  std::deque<std::string_view> lines{};
+  Utils::split_into(file.get_contents(), '\n', lines);
+  if (lines.empty()) {
+    return false;
+  }
+
+  for (auto&& line : lines) {
+    const size_t separator{line.find(' ')};
+    if (separator == std::string_view::npos) {
+      return false;
+    }
+
+    const std::string path{line.substr(separator + 1)};
+    if (get_state(path) != line.substr(0, separator)) {
+      LITR_CORE_TRACE("Traced input {} changed", path);
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void TracedInputs::set(uint64_t key, const std::vector<std::string>& files) const {
+  LITR_PROFILE_FUNCTION();
+
+  std::error_code error{};
+  std::filesystem::create_directories(m_directory.to_string(), error);
+
+  std::string contents{};
+  for (auto&& path : files) {
+    contents.append(fmt::format("{} {}\n", get_state(path), path));
+  }
+
+  const Path file_path{get_file_path(key)};
+  if (!FileSystem::write_file(file_path, contents)) {
+    LITR_CORE_TRACE("Could not write traced inputs {}", file_path);
+  }
+}
+
+std::string TracedInputs::get_state(const std::string& file) {
+  LITR_PROFILE_FUNCTION();
+
+  std::error_code error{};
+  const std::filesystem::file_status status{std::filesystem::status(file, error)};
+  if (!std::filesystem::exists(status)) {
+    return "-";
+  }
+
+  const auto modified{std::filesystem::last_write_time(file, error)};
+  const uintmax_t size{
+      std::filesystem::is_regular_file(status) ? std::filesystem::file_size(file, error) : 0};
+
+  return fmt::format("{:x}:{:x}", modified.time_since_epoch().count(), size);
+}
+
+Path TracedInputs::get_file_path(uint64_t key) const {
+  LITR_PROFILE_FUNCTION();
+
+  return m_directory.append(Utils::to_hex(key));
+}
+
+}  // namespace Litr::CLI
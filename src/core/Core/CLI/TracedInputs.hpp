@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Core/FileSystem.hpp"
+
+namespace Litr::CLI {
+
+// Files a script used the last time it succeeded, found by tracing it, to skip it as
+// long as none of them changed. Every entry is a file in the cache directory, named after
+// the same key as the output cache uses.
+class TracedInputs {
+ public:
+  TracedInputs();
+  explicit TracedInputs(Path directory);
+
+  // False if nothing is known about the script yet.
+  [[nodiscard]] bool is_unchanged(uint64_t key) const;
+  void set(uint64_t key, const std::vector<std::string>& files) const;
+
+ private:
+  // Modification time and size of a file, a file that does not exist has a state as well.
+  [[nodiscard]] static std::string get_state(const std::string& file);
+  [[nodiscard]] Path get_file_path(uint64_t key) const;
+
+  const Path m_directory;
+};
+
+}  // namespace Litr::CLI
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Watch.hpp"
+
+#include <fmt/color.h>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <utility>
+
+#include "Core/CLI/Changes.hpp"
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/Error/Handler.hpp"
+#include "Core/Error/Reporter.hpp"
+#include "Core/FileSystem.hpp"
+#include "Core/Log.hpp"
+#include "Core/Utils.hpp"
+
+namespace Litr::CLI {
+
+Watch::Watch(const std::shared_ptr<Instruction>& instruction,
+    std::shared_ptr<Config::Loader> config,
+    Config::Loader::Mode mode)
+    : m_instruction(instruction),
+      m_mode(mode),
+      m_config_path(config->get_file_path()),
+      m_config(std::move(config)),
+      m_config_files(get_config_files(m_config)) {}
+
+void Watch::run() {
+  LITR_PROFILE_FUNCTION();
+
+  if (!FileWatcher::is_supported()) {
+    Error::Handler::push(
+        Error::ExecutionFailureError("Watching files is not supported on this platform."));
+    return;
+  }
+
+  // Saving a file often means more than one change, e.g. writing a copy and renaming it.
+  constexpr std::chrono::milliseconds quiet_period{100};
+
+  const Path directory{m_config_path.without_filename()};
+  m_watcher.add_directory(directory);
+  m_watched_directories.emplace_back(
+      Utils::trim_right(FileSystem::get_absolute_path(directory).to_string(), '/'));
+
+  create_interpreter();
+  execute();
+
+  while (true) {
+    const FileWatcher::Files files{m_watcher.wait(quiet_period)};
+    if (files.empty()) {
+      return;
+    }
+
+    if (is_config_changed(files)) {
+      reload_config();
+    }
+
+    // A watched directory itself changing means changes got lost.
+    for (auto&& file : files) {
+      m_run_all = m_run_all || std::find(m_watched_directories.begin(),
+                                   m_watched_directories.end(),
+                                   file) != m_watched_directories.end();
+      m_changes.insert(file);
+    }
+
+    if (m_interpreter != nullptr) {
+      execute();
+    }
+  }
+}
+
+void Watch::execute() {
+  LITR_PROFILE_FUNCTION();
+
+  if (m_run_all) {
+    m_interpreter->set_changes(nullptr);
+  } else {
+    fmt::print(fg(fmt::color::dark_gray), "[watch] Files changed: {}\n", m_changes.size());
+    m_interpreter->set_changes(Changes::from_files({m_changes.begin(), m_changes.end()}));
+  }
+
+  m_interpreter->execute();
+  watch_used_directories();
+
+  if (m_interpreter->is_cancelled()) {
+    fmt::print(fg(fmt::color::dark_gray), "[watch] Files changed, the run is cancelled.\n");
+    Error::Handler::flush();
+    return;
+  }
+
+  print_errors();
+  m_changes.clear();
+  m_run_all = false;
+  fmt::print(fg(fmt::color::dark_gray), "[watch] Waiting for changes ...\n");
+}
+
+void Watch::reload_config() {
+  LITR_PROFILE_FUNCTION();
+
+  fmt::print(fg(fmt::color::dark_gray), "[watch] Configuration changed, reading it again.\n");
+
+  m_interpreter.reset();
+  m_config = std::make_shared<Config::Loader>(m_config_path, m_mode);
+  m_run_all = true;
+
+  // The old files are still watched for a fix, the ones included now might be broken.
+  if (Error::Handler::has_errors()) {
+    print_errors();
+    return;
+  }
+
+  m_config_files = get_config_files(m_config);
+  create_interpreter();
+}
+
+void Watch::create_interpreter() {
+  LITR_PROFILE_FUNCTION();
+
+  m_interpreter = std::make_unique<Interpreter>(m_instruction, m_config);
+  m_used_directory_count = 0;
+
+  // Asked before every script and while one runs, directories of a command are known by then.
+  m_interpreter->set_cancel_check([this]() {
+    watch_used_directories();
+    return m_watcher.has_changes();
+  });
+}
+
+void Watch::watch_used_directories() {
+  LITR_PROFILE_FUNCTION();
+
+  // Directories are only ever added, the ones known already need no second look.
+  const std::set<std::string>& used_directories{m_interpreter->get_used_directories()};
+  if (used_directories.size() == m_used_directory_count) {
+    return;
+  }
+  m_used_directory_count = used_directories.size();
+
+  // Commands can run anywhere, e.g. in a sibling of the directory of the configuration.
+  for (auto&& used : used_directories) {
+    const std::string directory{
+        Utils::trim_right(FileSystem::get_absolute_path(Path{used}).to_string(), '/')};
+    const bool is_watched{std::any_of(m_watched_directories.begin(),
+        m_watched_directories.end(),
+        [&directory](const std::string& watched) {
+          return directory == watched || directory.rfind(watched + '/', 0) == 0;
+        })};
+
+    if (!is_watched) {
+      LITR_CORE_TRACE("Watching directory {} of a command as well", directory);
+      m_watcher.add_directory(Path{directory});
+      m_watched_directories.push_back(directory);
+    }
+  }
+}
+
+void Watch::print_errors() const {
+  LITR_PROFILE_FUNCTION();
+
+  if (Error::Handler::has_errors()) {
+    Error::Reporter reporter{m_config_path};
+    reporter.print_errors(Error::Handler::get_errors());
+    Error::Handler::flush();
+  }
+}
+
+bool Watch::is_config_changed(const FileWatcher::Files& files) const {
+  LITR_PROFILE_FUNCTION();
+
+  return std::any_of(files.begin(), files.end(), [this](const std::string& file) {
+    // New packages can be included by a pattern, even without changing a known file.
+    const std::string name{std::filesystem::path{file}.filename().string()};
+    return name == "litr.toml" || name == ".litr.toml" ||
+           std::find(m_config_files.begin(), m_config_files.end(), file) != m_config_files.end();
+  });
+}
+
+std::vector<std::string> Watch::get_config_files(const std::shared_ptr<Config::Loader>& config) {
+  LITR_PROFILE_FUNCTION();
+
+  std::vector<std::string> files{};
+  for (auto&& path : config->get_file_paths()) {
+    files.push_back(std::filesystem::absolute(path.to_string()).lexically_normal().string());
+  }
+
+  return files;
+}
+
+}  // namespace Litr::CLI
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Core/CLI/Instruction.hpp"
+#include "Core/CLI/Interpreter.hpp"
+#include "Core/Config/Loader.hpp"
+#include "Core/FileWatcher.hpp"
+
+namespace Litr::CLI {
+
+// Runs all instructions again whenever files change below the directory of the
+// configuration, or below a directory of a command that ran. Only directories with changed
+// files run again and a run still going is cancelled once new changes arrive, ending the
+// script running as well. The configuration is only read again if one of its files changed.
+class Watch {
+ public:
+  Watch(const std::shared_ptr<Instruction>& instruction,
+      std::shared_ptr<Config::Loader> config,
+      Config::Loader::Mode mode);
+
+  // Runs once right away, then on every change until the process is stopped.
+  void run();
+
+ private:
+  void execute();
+  void reload_config();
+  void create_interpreter();
+  void watch_used_directories();
+  void print_errors() const;
+
+  [[nodiscard]] bool is_config_changed(const FileWatcher::Files& files) const;
+  [[nodiscard]] static std::vector<std::string> get_config_files(
+      const std::shared_ptr<Config::Loader>& config);
+
+  const std::shared_ptr<Instruction>& m_instruction;
+  const Config::Loader::Mode m_mode;
+  const Path m_config_path;
+  std::shared_ptr<Config::Loader> m_config;
+  std::vector<std::string> m_config_files;
+  std::unique_ptr<Interpreter> m_interpreter{};
+  FileWatcher m_watcher{};
+  // Absolute, a directory inside one of them is watched already.
+  std::vector<std::string> m_watched_directories{};
+  // Directories of the interpreter looked at so far.
+  size_t m_used_directory_count{0};
+
+  // Changes of a cancelled run are still not done and run again with the next one.
+  std::set<std::string> m_changes{};
+  bool m_run_all{true};
+};
+
+}  // namespace Litr::CLI
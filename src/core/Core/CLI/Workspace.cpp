@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Workspace.hpp"
+
+#include <fmt/color.h>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+
+#include "Core/CLI/Benchmark.hpp"
+#include "Core/CLI/Interpreter.hpp"
+#include "Core/Config/Query.hpp"
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/DirectoryWalker.hpp"
+#include "Core/Error/Reporter.hpp"
+#include "Core/ThreadPool.hpp"
+
+namespace Litr::CLI {
+
+Workspace::Workspace(const std::shared_ptr<Instruction>& instruction, const Path& root)
+    : m_instruction(instruction),
+      m_packages(find_packages(root)),
+      m_resources(std::make_shared<Resources>(read_capacities(m_packages))) {}
+
+void Workspace::run(size_t jobs) {
+  LITR_PROFILE_FUNCTION();
+
+  // Bounds that are the same never change the limit, there is nothing to report either.
+  Throttle throttle{jobs, jobs, {}};
+  run_packages(&throttle);
+}
+
+void Workspace::run_adaptive(size_t min_jobs, size_t max_jobs) {
+  LITR_PROFILE_FUNCTION();
+
+  Throttle throttle{min_jobs, max_jobs, [this](size_t from, const Throttle::Decision& decision) {
+    print_throttle(from, decision);
+  }};
+  run_packages(&throttle);
+}
+
+void Workspace::run_packages(Throttle* throttle) {
+  LITR_PROFILE_FUNCTION();
+
+  // Errors cannot be assigned, every result is created in place instead.
+  std::vector<std::optional<Result>> results(m_packages.size());
+
+  // Every package has a thread, the calling one included. The throttle only limits packages
+  // running scripts, one waiting for resources leaves its place to the others meanwhile.
+  ThreadPool pool{m_packages.size() > 1 ? m_packages.size() - 1 : 0};
+  pool.run(m_packages.size(), [this, &results, throttle](size_t index) {
+    print_result(
+        m_packages[index], results[index].emplace(run_package(m_packages[index], throttle)));
+  });
+
+  m_results.clear();
+  m_results.reserve(results.size());
+  for (auto&& result : results) {
+    m_results.push_back(std::move(*result));
+  }
+}
+
+void Workspace::print_summary() const {
+  LITR_PROFILE_FUNCTION();
+
+  size_t succeeded{0};
+  size_t failed{0};
+  size_t skipped{0};
+
+  fmt::print(fmt::emphasis::bold, "Summary\n");
+
+  for (size_t index{0}; index < m_results.size(); ++index) {
+    const Package& package{m_packages[index]};
+    const Result& result{m_results[index]};
+
+    switch (result.status) {
+      case Status::SUCCESS: {
+        fmt::print(fg(fmt::color::green), "  ✓ {}", package.name);
+        fmt::print(fg(fmt::color::dark_gray),
+            " ({})\n",
+            Benchmark::format_duration(result.duration));
+        ++succeeded;
+        break;
+      }
+      case Status::FAILURE: {
+        fmt::print(fg(fmt::color::crimson), "  ✗ {}", package.name);
+        fmt::print(fg(fmt::color::dark_gray),
+            " ({})\n",
+            Benchmark::format_duration(result.duration));
+        ++failed;
+        break;
+      }
+      case Status::SKIPPED: {
+        fmt::print(fg(fmt::color::dark_gray), "  - {} (command not defined)\n", package.name);
+        ++skipped;
+        break;
+      }
+    }
+  }
+
+  fmt::print("  {} succeeded, {} failed, {} skipped\n", succeeded, failed, skipped);
+}
+
+bool Workspace::has_failures() const {
+  LITR_PROFILE_FUNCTION();
+
+  return std::any_of(m_results.begin(), m_results.end(), [](const Result& result) {
+    return result.status == Status::FAILURE;
+  });
+}
+
+Path Workspace::find_root(const Path& directory) {
+  LITR_PROFILE_FUNCTION();
+
+  Path current{directory};
+
+  do {
+    if (FileSystem::exists(current.append(std::string{".git"}))) {
+      return current;
+    }
+    current = current.parent_path();
+  } while (current != current.parent_path());
+
+  return directory;
+}
+
+std::vector<Workspace::Package> Workspace::find_packages(const Path& root) {
+  LITR_PROFILE_FUNCTION();
+
+  DirectoryWalker walker{root};
+  walker.set_respect_git_ignore(true);
+
+  const std::vector<DirectoryWalker::Entry> files{
+      walker.walk([](const DirectoryWalker::Entry& entry) {
+        if (entry.is_directory) {
+          return false;
+        }
+
+        const std::string name{entry.path.filename()};
+        return name == "litr.toml" || name == ".litr.toml";
+      })};
+
+  std::vector<Package> packages{};
+  packages.reserve(files.size());
+
+  for (auto&& file : files) {
+    const Path directory{file.path.without_filename()};
+
+    // Same as resolving a single file, a hidden file next to a visible one is not used.
+    if (file.path.filename() == ".litr.toml" &&
+        FileSystem::exists(directory.append(std::string{"litr.toml"}))) {
+      continue;
+    }
+
+    const size_t separator{file.relative_path.rfind('/')};
+    packages.push_back({file.path,
+        separator == std::string::npos ? "." : file.relative_path.substr(0, separator)});
+  }
+
+  // Files are sorted by path, packages should be by their directory.
+  std::stable_sort(packages.begin(),
+      packages.end(),
+      [](const Package& left, const Package& right) { return left.name < right.name; });
+
+  return packages;
+}
+
+Resources::Capacities Workspace::read_capacities(const std::vector<Package>& packages) {
+  LITR_PROFILE_FUNCTION();
+
+  const auto root{std::find_if(packages.begin(), packages.end(), [](const Package& package) {
+    return package.name == ".";
+  })};
+  if (root == packages.end()) {
+    return {};
+  }
+
+  const bool had_errors{Error::Handler::has_errors()};
+  const Config::Loader config{root->file_path, Config::Loader::Mode::LAZY};
+  Resources::Capacities capacities{config.get_settings().resources};
+
+  // The root package reports its own errors once it runs.
+  if (!had_errors) {
+    Error::Handler::flush();
+  }
+
+  return capacities;
+}
+
+Workspace::Result Workspace::run_package(const Package& package, Throttle* throttle) const {
+  LITR_PROFILE_FUNCTION();
+
+  Status status{Status::SKIPPED};
+  std::string output{};
+  const auto start{std::chrono::steady_clock::now()};
+
+  // Errors are collected per thread, whatever is left belongs to this package.
+  const auto config{
+      std::make_shared<Config::Loader>(package.file_path, Config::Loader::Mode::LAZY)};
+
+  if (!Error::Handler::has_errors() && has_commands(config)) {
+    Interpreter interpreter{m_instruction, config};
+    interpreter.set_default_directory(package.file_path.without_filename());
+    interpreter.set_output([&output](const std::string& line) { output.append(line); });
+    interpreter.set_resources(m_resources);
+    interpreter.set_throttle(throttle);
+    interpreter.execute();
+    status = Status::SUCCESS;
+  }
+
+  Result result{status, std::move(output), Error::Handler::get_errors(), {}};
+  if (!result.errors.empty()) {
+    result.status = Status::FAILURE;
+  }
+  result.duration = std::chrono::steady_clock::now() - start;
+  Error::Handler::flush();
+
+  return result;
+}
+
+bool Workspace::has_commands(const std::shared_ptr<Config::Loader>& config) const {
+  LITR_PROFILE_FUNCTION();
+
+  const Config::Query query{config};
+  bool has_commands{false};
+  size_t offset{0};
+
+  while (offset < m_instruction->count()) {
+    const auto code{static_cast<Instruction::Code>(m_instruction->read(offset++))};
+
+    if (code == Instruction::Code::CLEAR) {
+      continue;
+    }
+
+    const Instruction::Value name{
+        m_instruction->read_constant(m_instruction->read_operand(offset))};
+    if (code != Instruction::Code::EXECUTE) {
+      continue;
+    }
+
+    // Packages not defining every command are skipped as a whole.
+    if (query.get_command(name) == nullptr) {
+      return false;
+    }
+    has_commands = true;
+  }
+
+  return has_commands;
+}
+
+void Workspace::print_result(const Package& package, const Result& result) {
+  LITR_PROFILE_FUNCTION();
+
+  if (result.status == Status::SKIPPED) {
+    return;
+  }
+
+  std::lock_guard lock{m_print_mutex};
+
+  fmt::print(fmt::emphasis::bold, "{}\n", package.name);
+  fmt::print("{}", result.output);
+
+  if (!result.errors.empty()) {
+    Error::Reporter reporter{package.file_path};
+    reporter.print_errors(result.errors);
+  }
+}
+
+void Workspace::print_throttle(size_t from, const Throttle::Decision& decision) {
+  LITR_PROFILE_FUNCTION();
+
+  std::lock_guard lock{m_print_mutex};
+
+  if (from == 0) {
+    fmt::print(fg(fmt::color::dark_gray),
+        "[jobs] Starting with {}, {}.\n",
+        decision.limit,
+        decision.reason);
+    return;
+  }
+
+  fmt::print(fg(fmt::color::dark_gray),
+      "[jobs] {} from {} to {}, {}.\n",
+      decision.limit < from ? "Lowered" : "Raised",
+      from,
+      decision.limit,
+      decision.reason);
+}
+
+}  // namespace Litr::CLI
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Core/CLI/Instruction.hpp"
+#include "Core/CLI/Resources.hpp"
+#include "Core/CLI/Throttle.hpp"
+#include "Core/Config/Loader.hpp"
+#include "Core/Error/Handler.hpp"
+#include "Core/FileSystem.hpp"
+
+namespace Litr::CLI {
+
+// Runs the same instructions in every package of a workspace, a directory tree where
+// packages have a configuration file of their own. Packages run in parallel inside one
+// process, their output is printed as a whole once a package is done. Resource capacities
+// are the ones of the configuration at the workspace root, if there is one.
+class Workspace {
+ public:
+  using Seconds = std::chrono::duration<double>;
+
+  struct Package {
+    Path file_path{};
+    // Directory relative to the workspace root.
+    std::string name{};
+  };
+
+  enum class Status { SUCCESS, FAILURE, SKIPPED };
+
+  struct Result {
+    Status status{Status::SKIPPED};
+    std::string output{};
+    Error::Handler::Errors errors{};
+    Seconds duration{0};
+  };
+
+  Workspace(const std::shared_ptr<Instruction>& instruction, const Path& root);
+
+  void run(size_t jobs);
+  // Runs as many packages at the same time as the load of the machine allows.
+  void run_adaptive(size_t min_jobs, size_t max_jobs);
+  void print_summary() const;
+
+  [[nodiscard]] bool has_failures() const;
+  [[nodiscard]] inline const std::vector<Package>& get_packages() const {
+    return m_packages;
+  }
+  [[nodiscard]] inline const std::vector<Result>& get_results() const {
+    return m_results;
+  }
+
+  // The root of the repository the directory is in, the directory itself if there is none.
+  [[nodiscard]] static Path find_root(const Path& directory);
+  // Configuration files below the root, skipping everything git ignores.
+  [[nodiscard]] static std::vector<Package> find_packages(const Path& root);
+
+ private:
+  [[nodiscard]] static Resources::Capacities read_capacities(
+      const std::vector<Package>& packages);
+  void run_packages(Throttle* throttle);
+  [[nodiscard]] Result run_package(const Package& package, Throttle* throttle) const;
+  [[nodiscard]] bool has_commands(const std::shared_ptr<Config::Loader>& config) const;
+  void print_result(const Package& package, const Result& result);
+  void print_throttle(size_t from, const Throttle::Decision& decision);
+
+  const std::shared_ptr<Instruction>& m_instruction;
+  const std::vector<Package> m_packages;
+  const std::shared_ptr<Resources> m_resources;
+  std::vector<Result> m_results{};
+
+  // Packages done at the same time would mix up their output.
+  std::mutex m_print_mutex{};
+};
+
+}  // namespace Litr::CLI
@@ -6,30 +6,70 @@
 
 #include <fmt/format.h>
 
-#include <memory>
+#include <chrono>
+#include <cstdint>
+#include <optional>
 #include <string>
-#include <utility>
-#include <vector>
+#include <string_view>
 
 #include "Core/Config/Location.hpp"
+#include "Core/Span.hpp"
 
 namespace Litr::Config {
 
+// A command is a plain record viewing into the `CommandTable` that created it, it is
+// only valid for as long as the table (and therefore the loader) exists.
 struct Command {
   enum class Output { UNCHANGED = 0, SILENT = 1 };
+  // Traced inputs are found while scripts run, a script is skipped until one changes.
+  enum class Inputs { UNKNOWN = 0, TRACED = 1 };
 
-  std::vector<std::string> script{};
-  std::vector<std::string> directory{};
+  // Output of a command with a time to live is kept and reused until it expires,
+  // instead of running the command again.
+  struct Cache {
+    std::chrono::seconds ttl{0};
+    // Names of environment variables the output depends on.
+    Span<const std::string_view> env{};
+  };
 
-  const std::string name;
-  std::string description{};
-  std::string example{};
-  std::vector<std::shared_ptr<Command>> child_commands{};
+  // An amount of something commands share while running at the same time, e.g. a database.
+  struct Resource {
+    std::string_view name{};
+    size_t amount{0};
+  };
+
+  // Applied to the processes of every script, only on Linux and macOS so far. Limits not
+  // given are the ones Litr itself runs with.
+  struct Limits {
+    std::optional<int> nice{};
+    // CPU numbers and ranges, e.g. `0-7,12`. Only bound to on Linux.
+    std::string_view cpus{};
+    // Address space of each process in bytes.
+    std::optional<uint64_t> memory{};
+    std::optional<uint64_t> open_files{};
+  };
+
+  Span<const std::string_view> script{};
+  Span<const std::string_view> directory{};
+  // Paths of other packages, a change in them affects all directories of the command.
+  Span<const std::string_view> affects{};
+
+  std::string_view name{};
+  std::string_view description{};
+  std::string_view example{};
+  Span<const Command> child_commands{};
 
   Output output{Output::UNCHANGED};
-  std::vector<Location> Locations{};
+  Cache cache{};
+  Inputs inputs{Inputs::UNKNOWN};
+  Span<const Resource> resources{};
+  Limits limits{};
+  // Scripts running longer are stopped, without a timeout they may run forever.
+  std::chrono::seconds timeout{0};
+  Span<const Location> Locations{};
 
-  explicit Command(std::string name) : name(std::move(name)) {}
+  Command() = default;
+  explicit Command(std::string_view name) : name(name) {}
 };
 
 }  // namespace Litr::Config
@@ -48,7 +88,7 @@ struct fmt::formatter<Litr::Config::Command> {
     std::string child_view{};
     if (!c.child_commands.empty()) {
       for (auto&& child : c.child_commands) {
-        child_view.append(fmt::format("\n    - Child{}", *child));
+        child_view.append(fmt::format("\n    - Child{}", child));
       }
     }
 
@@ -6,27 +6,33 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <optional>
+#include <utility>
+
 #include "Core/Error/Handler.hpp"
+#include "Core/Utils.hpp"
 
 namespace Litr::Config {
 
-CommandBuilder::CommandBuilder(const TomlFileAdapter::Value& context,
-    const TomlFileAdapter::Value& data,
-    const std::string& name)
-    : m_context(context),
+CommandBuilder::CommandBuilder(CommandTable& table,
+    const Value& context,
+    const Value& data,
+    std::string_view name)
+    : m_commands(table),
+      m_context(context),
       m_table(data),
-      m_command(std::make_shared<Command>(name)) {
-  LITR_CORE_TRACE("Creating {}", *m_command);
+      m_command(table.intern(name)) {
+  LITR_CORE_TRACE("Creating {}", m_command);
 }
 
-void CommandBuilder::add_script_line(const std::string& line) {
+void CommandBuilder::add_script_line(std::string_view line) {
   LITR_PROFILE_FUNCTION();
 
-  m_command->script.emplace_back(line);
+  m_command.script = m_commands.append_string(m_command.script, line);
 }
 
-void CommandBuilder::add_script_line(
-    const std::string& line, const TomlFileAdapter::Value& context) {
+void CommandBuilder::add_script_line(std::string_view line, const Value& context) {
   add_script_line(line);
   add_location(context);
 }
@@ -34,17 +40,20 @@ void CommandBuilder::add_script_line(
 void CommandBuilder::add_script(const std::vector<std::string>& scripts) {
   LITR_PROFILE_FUNCTION();
 
-  m_command->script = scripts;
+  m_command.script = {};
+  for (auto&& script : scripts) {
+    m_command.script = m_commands.append_string(m_command.script, script);
+  }
 }
 
-void CommandBuilder::add_script(const TomlFileAdapter::Value& scripts) {
+void CommandBuilder::add_script(const Value& scripts) {
   LITR_PROFILE_FUNCTION();
 
   for (auto&& script : scripts.as_array()) {
     if (!script.is_string()) {
       Error::Handler::push(Error::MalformedScriptError(
           "A command script can be either a string or array of strings.",
-          m_context.at(m_command->name)));
+          m_context.at(m_command.name)));
       // Stop after first error in an array of scripts, to avoid being too verbose.
       break;
     }
@@ -59,10 +68,10 @@ void CommandBuilder::add_description() {
   const std::string name{"description"};
 
   if (m_table.contains(name)) {
-    const TomlFileAdapter::Value& description{m_file.find(m_table, name)};
+    const Value& description{m_file.find(m_table, name)};
 
     if (description.is_string()) {
-      m_command->description = description.as_string();
+      m_command.description = m_commands.intern(description.as_string());
       return;
     }
 
@@ -77,9 +86,9 @@ void CommandBuilder::add_example() {
   const std::string name{"example"};
 
   if (m_table.contains(name)) {
-    const TomlFileAdapter::Value& example{m_file.find(m_table, name)};
+    const Value& example{m_file.find(m_table, name)};
     if (example.is_string()) {
-      m_command->example = example.as_string();
+      m_command.example = m_commands.intern(example.as_string());
       return;
     }
 
@@ -94,49 +103,43 @@ void CommandBuilder::add_directory(const Path& root) {
   const std::string name{"dir"};
 
   if (m_table.contains(name)) {
-    const TomlFileAdapter::Value& directories{m_file.find(m_table, name)};
+    // Replaces the default directory.
+    m_command.directory = create_paths(name, root);
+  }
+}
 
-    if (directories.is_string()) {
-      m_command->directory.emplace_back(root.append(directories.as_string()));
-      return;
-    }
+void CommandBuilder::add_affects(const Path& root) {
+  LITR_PROFILE_FUNCTION();
 
-    if (directories.is_array()) {
-      for (auto&& directory : directories.as_array()) {
-        if (!directory.is_string()) {
-          Error::Handler::push(Error::MalformedCommandError(
-              fmt::format(R"(A "{}" can either be a string or array of strings.)", name),
-              m_table.at(name)));
-          continue;
-        }
+  const std::string name{"affects"};
 
-        m_command->directory.emplace_back(root.append(directory.as_string()));
-      }
-      return;
-    }
-
-    Error::Handler::push(Error::MalformedCommandError(
-        fmt::format(R"(A "{}" can either be a string or array of strings.)", name),
-        m_table.at(name)));
+  if (m_table.contains(name)) {
+    m_command.affects = create_paths(name, root);
   }
 }
 
+void CommandBuilder::add_default_directory(const Path& directory) {
+  LITR_PROFILE_FUNCTION();
+
+  m_command.directory = m_commands.append_string({}, directory.to_string());
+}
+
 void CommandBuilder::add_output() {
   LITR_PROFILE_FUNCTION();
 
   const std::string name{"output"};
 
   if (m_table.contains(name)) {
-    const TomlFileAdapter::Value& output{m_file.find(m_table, name)};
+    const Value& output{m_file.find(m_table, name)};
 
     if (output.is_string()) {
       if (output.as_string() == "silent") {
-        m_command->output = Command::Output::SILENT;
+        m_command.output = Command::Output::SILENT;
         return;
       }
 
       if (output.as_string() == "unchanged") {
-        m_command->output = Command::Output::UNCHANGED;
+        m_command.output = Command::Output::UNCHANGED;
         return;
       }
     }
@@ -146,17 +149,273 @@ void CommandBuilder::add_output() {
   }
 }
 
-void CommandBuilder::add_child_command(const std::shared_ptr<Command>& command) {
+void CommandBuilder::add_inputs() {
+  LITR_PROFILE_FUNCTION();
+
+  const std::string name{"inputs"};
+
+  if (m_table.contains(name)) {
+    const Value& inputs{m_file.find(m_table, name)};
+
+    if (inputs.is_string() && inputs.as_string() == "traced") {
+      m_command.inputs = Command::Inputs::TRACED;
+      return;
+    }
+
+    Error::Handler::push(Error::MalformedCommandError(
+        fmt::format(R"(The "{}" can only be "traced" so far.)", name), m_table.at(name)));
+  }
+}
+
+void CommandBuilder::add_resources() {
+  LITR_PROFILE_FUNCTION();
+
+  const std::string name{"resources"};
+
+  if (!m_table.contains(name)) {
+    return;
+  }
+
+  const Value& resources{m_file.find(m_table, name)};
+  const bool is_valid{resources.is_table() &&
+                      std::all_of(resources.as_table().begin(),
+                          resources.as_table().end(),
+                          [](const std::pair<std::string_view, Value>& resource) {
+                            return resource.second.is_integer() &&
+                                   resource.second.as_integer() > 0;
+                          })};
+
+  if (!is_valid) {
+    Error::Handler::push(Error::MalformedCommandError(
+        fmt::format(R"(The "{}" can only be a table of positive whole numbers, )"
+                    R"(e.g. `{} = {{ db = 1 }}`.)",
+            name,
+            name),
+        m_table.at(name)));
+    return;
+  }
+
+  for (auto&& [resource, amount] : resources.as_table()) {
+    m_command.resources = m_commands.append_resource(m_command.resources,
+        {m_commands.intern(resource), static_cast<size_t>(amount.as_integer())});
+  }
+}
+
+void CommandBuilder::add_nice() {
+  LITR_PROFILE_FUNCTION();
+
+  // Same as the range of niceness on Linux.
+  constexpr int64_t min_nice{-20};
+  constexpr int64_t max_nice{19};
+  const std::string name{"nice"};
+
+  if (!m_table.contains(name)) {
+    return;
+  }
+
+  const Value& nice{m_file.find(m_table, name)};
+  if (!nice.is_integer() || nice.as_integer() < min_nice || nice.as_integer() > max_nice) {
+    Error::Handler::push(Error::MalformedCommandError(
+        fmt::format(R"(The "{}" can only be a whole number from {} to {}.)",
+            name,
+            min_nice,
+            max_nice),
+        m_table.at(name)));
+    return;
+  }
+
+  m_command.limits.nice = static_cast<int>(nice.as_integer());
+}
+
+void CommandBuilder::add_cpus() {
+  LITR_PROFILE_FUNCTION();
+
+  const std::string name{"cpus"};
+
+  if (!m_table.contains(name)) {
+    return;
+  }
+
+  const Value& cpus{m_file.find(m_table, name)};
+  if (!cpus.is_string() || !Utils::parse_cpus(cpus.as_string()).has_value()) {
+    Error::Handler::push(Error::MalformedCommandError(
+        fmt::format(R"(The "{}" can only be a list of CPU numbers, e.g. `{} = "0-7,12"`.)",
+            name,
+            name),
+        m_table.at(name)));
+    return;
+  }
+
+  m_command.limits.cpus = m_commands.intern(cpus.as_string());
+}
+
+void CommandBuilder::add_limits() {
   LITR_PROFILE_FUNCTION();
 
-  m_command->child_commands.emplace_back(command);
+  const std::string name{"limits"};
+
+  if (!m_table.contains(name)) {
+    return;
+  }
+
+  const Value& limits{m_file.find(m_table, name)};
+  if (!limits.is_table()) {
+    Error::Handler::push(Error::MalformedCommandError(
+        fmt::format(R"(The "{}" can only be a table, e.g. `{} = {{ memory = "4G" }}`.)",
+            name,
+            name),
+        m_table.at(name)));
+    return;
+  }
+
+  for (auto&& [limit, value] : limits.as_table()) {
+    if (limit == "memory") {
+      const std::optional<uint64_t> memory{
+          value.is_string() ? Utils::parse_size(value.as_string()) : std::nullopt};
+      if (!memory.has_value() || *memory == 0) {
+        Error::Handler::push(Error::MalformedCommandError(
+            R"(The "memory" limit can only be a size, e.g. `memory = "4G"`.)", value));
+        continue;
+      }
+
+      m_command.limits.memory = memory;
+      continue;
+    }
+
+    if (limit == "open_files") {
+      if (!value.is_integer() || value.as_integer() <= 0) {
+        Error::Handler::push(Error::MalformedCommandError(
+            R"(The "open_files" limit can only be a positive whole number.)", value));
+        continue;
+      }
+
+      m_command.limits.open_files = static_cast<uint64_t>(value.as_integer());
+      continue;
+    }
+
+    Error::Handler::push(Error::MalformedCommandError(
+        fmt::format(R"(The limit "{}" is not known, only "memory" and "open_files" are.)",
+            limit),
+        value));
+  }
+}
+
+void CommandBuilder::add_timeout() {
+  LITR_PROFILE_FUNCTION();
+
+  const std::string name{"timeout"};
+
+  if (!m_table.contains(name)) {
+    return;
+  }
+
+  const Value& timeout{m_file.find(m_table, name)};
+  const std::optional<std::chrono::seconds> duration{
+      timeout.is_string() ? Utils::parse_duration(timeout.as_string()) : std::nullopt};
+
+  if (!duration.has_value() || duration->count() == 0) {
+    Error::Handler::push(Error::MalformedCommandError(
+        fmt::format(R"(The "{}" can only be a duration, e.g. `{} = "15m"`.)", name, name),
+        m_table.at(name)));
+    return;
+  }
+
+  m_command.timeout = *duration;
+}
+
+void CommandBuilder::add_cache() {
+  LITR_PROFILE_FUNCTION();
+
+  const std::string name{"cache"};
+
+  if (!m_table.contains(name)) {
+    return;
+  }
+
+  const Value& cache{m_file.find(m_table, name)};
+  const std::optional<std::chrono::seconds> ttl{
+      cache.is_table() && cache.contains("ttl") && m_file.find(cache, "ttl").is_string()
+          ? Utils::parse_duration(m_file.find(cache, "ttl").as_string())
+          : std::nullopt};
+
+  if (!ttl.has_value() || ttl->count() == 0) {
+    Error::Handler::push(Error::MalformedCommandError(
+        fmt::format(R"(A "{}" needs a "ttl" duration, e.g. `{} = {{ ttl = "10m" }}`.)",
+            name,
+            name),
+        m_table.at(name)));
+    return;
+  }
+
+  m_command.cache.ttl = *ttl;
+
+  if (cache.contains("env")) {
+    const Value& variables{m_file.find(cache, "env")};
+    const bool is_valid{variables.is_array() &&
+                        std::all_of(variables.as_array().begin(),
+                            variables.as_array().end(),
+                            [](const Value& variable) { return variable.is_string(); })};
+
+    if (!is_valid) {
+      Error::Handler::push(Error::MalformedCommandError(
+          fmt::format(R"(The "{}" environment can only be an array of strings.)", name),
+          cache.at("env")));
+      return;
+    }
+
+    for (auto&& variable : variables.as_array()) {
+      m_command.cache.env = m_commands.append_string(m_command.cache.env, variable.as_string());
+    }
+  }
+}
+
+void CommandBuilder::add_child_command(const Command& command) {
+  LITR_PROFILE_FUNCTION();
+
+  m_command.child_commands = m_commands.append_command(m_command.child_commands, command);
+}
+
+Span<const std::string_view> CommandBuilder::create_paths(
+    const std::string& name, const Path& root) {
+  LITR_PROFILE_FUNCTION();
+
+  const Value& paths{m_file.find(m_table, name)};
+  Span<const std::string_view> result{};
+
+  if (paths.is_string()) {
+    return m_commands.append_string(
+        result, root.append(std::string{paths.as_string()}).to_string());
+  }
+
+  if (paths.is_array()) {
+    for (auto&& path : paths.as_array()) {
+      if (!path.is_string()) {
+        Error::Handler::push(Error::MalformedCommandError(
+            fmt::format(R"(A "{}" can either be a string or array of strings.)", name),
+            m_table.at(name)));
+        continue;
+      }
+
+      result = m_commands.append_string(
+          result, root.append(std::string{path.as_string()}).to_string());
+    }
+    return result;
+  }
+
+  Error::Handler::push(Error::MalformedCommandError(
+      fmt::format(R"(A "{}" can either be a string or array of strings.)", name),
+      m_table.at(name)));
+  return result;
 }
 
-void CommandBuilder::add_location(const TomlFileAdapter::Value& context) {
+void CommandBuilder::add_location(const Value& context) {
   LITR_PROFILE_FUNCTION();
 
-  m_command->Locations.emplace_back(
-      context.location().line(), context.location().column(), context.location().line_str());
+  m_command.Locations = m_commands.append_location(m_command.Locations,
+      Location(context.location().line(),
+          context.location().column(),
+          context.location().line_str(),
+          context.location().file_name()));
 }
 
 }  // namespace Litr::Config
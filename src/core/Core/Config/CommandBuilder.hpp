@@ -4,46 +4,59 @@
 
 #pragma once
 
-#include <tsl/ordered_map.h>
-
-#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "Core/Config/Command.hpp"
-#include "Core/Config/TomlFileAdapter.hpp"
+#include "Core/Config/CommandTable.hpp"
+#include "Core/Config/MappedFileAdapter.hpp"
+#include "Core/Config/Value.hpp"
 #include "Core/FileSystem.hpp"
 
 namespace Litr::Config {
 
 class CommandBuilder {
  public:
-  CommandBuilder(const TomlFileAdapter::Value& context,
-      const TomlFileAdapter::Value& data,
-      const std::string& name);
+  CommandBuilder(CommandTable& table,
+      const Value& context,
+      const Value& data,
+      std::string_view name);
 
-  void add_script_line(const std::string& line);
-  void add_script_line(const std::string& line, const TomlFileAdapter::Value& context);
+  void add_script_line(std::string_view line);
+  void add_script_line(std::string_view line, const Value& context);
   void add_script(const std::vector<std::string>& scripts);
-  void add_script(const TomlFileAdapter::Value& scripts);
+  void add_script(const Value& scripts);
 
   void add_description();
   void add_example();
   void add_directory(const Path& root);
+  void add_default_directory(const Path& directory);
+  void add_affects(const Path& root);
   void add_output();
-  void add_child_command(const std::shared_ptr<Command>& command);
-
-  [[nodiscard]] inline std::shared_ptr<Command> get_result() const {
-    return m_command;
+  void add_inputs();
+  void add_cache();
+  void add_resources();
+  void add_nice();
+  void add_cpus();
+  void add_limits();
+  void add_timeout();
+  void add_child_command(const Command& command);
+
+  [[nodiscard]] inline const Command* get_result() const {
+    return &m_command;
   }
 
  private:
-  void add_location(const TomlFileAdapter::Value& context);
-
-  const TomlFileAdapter::Value& m_context;
-  const TomlFileAdapter::Value& m_table;
-  const std::shared_ptr<Command> m_command;
-  const TomlFileAdapter m_file{};
+  [[nodiscard]] Span<const std::string_view> create_paths(
+      const std::string& name, const Path& root);
+  void add_location(const Value& context);
+
+  CommandTable& m_commands;
+  const Value& m_context;
+  const Value& m_table;
+  Command m_command;
+  const MappedFileAdapter m_file{};
 };
 
 }  // namespace Litr::Config
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "CommandTable.hpp"
+
+#include <algorithm>
+
+#include "Core/Debug/Instrumentor.hpp"
+
+namespace Litr::Config {
+
+std::string_view CommandTable::intern(std::string_view value) {
+  LITR_PROFILE_FUNCTION();
+
+  return m_strings.intern(value);
+}
+
+Span<const std::string_view> CommandTable::append_string(
+    Span<const std::string_view> strings, std::string_view value) {
+  LITR_PROFILE_FUNCTION();
+
+  return m_string_lists.append(strings, m_strings.intern(value));
+}
+
+Span<const Location> CommandTable::append_location(
+    Span<const Location> locations, const Location& location) {
+  LITR_PROFILE_FUNCTION();
+
+  return m_locations.append(locations, location);
+}
+
+Span<const Command::Resource> CommandTable::append_resource(
+    Span<const Command::Resource> resources, const Command::Resource& resource) {
+  LITR_PROFILE_FUNCTION();
+
+  return m_resources.append(resources, resource);
+}
+
+Span<const Command> CommandTable::append_command(
+    Span<const Command> commands, const Command& command) {
+  LITR_PROFILE_FUNCTION();
+
+  return m_commands.append(commands, command);
+}
+
+Span<const Command> CommandTable::add_commands(const std::vector<Command>& commands) {
+  LITR_PROFILE_FUNCTION();
+
+  const Span<Command> block{m_commands.allocate(commands.size())};
+  std::copy(commands.begin(), commands.end(), block.begin());
+  return block;
+}
+
+}  // namespace Litr::Config
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+#include "Core/Arena.hpp"
+#include "Core/Config/Command.hpp"
+#include "Core/Config/Location.hpp"
+#include "Core/StringPool.hpp"
+
+namespace Litr::Config {
+
+// Owns all data of loaded commands in a few contiguous arenas. Commands only hold
+// views into this table, no command or part of it gets allocated on its own.
+class CommandTable {
+ public:
+  CommandTable() = default;
+
+  // Neither copy nor move, commands point into the table.
+  CommandTable(const CommandTable&) = delete;
+  CommandTable(CommandTable&&) = delete;
+  CommandTable& operator=(const CommandTable&) = delete;
+  CommandTable& operator=(CommandTable&&) = delete;
+  ~CommandTable() = default;
+
+  [[nodiscard]] std::string_view intern(std::string_view value);
+
+  [[nodiscard]] Span<const std::string_view> append_string(
+      Span<const std::string_view> strings, std::string_view value);
+  [[nodiscard]] Span<const Location> append_location(
+      Span<const Location> locations, const Location& location);
+  [[nodiscard]] Span<const Command::Resource> append_resource(
+      Span<const Command::Resource> resources, const Command::Resource& resource);
+  [[nodiscard]] Span<const Command> append_command(
+      Span<const Command> commands, const Command& command);
+
+  // Stores a list of sibling commands as one contiguous block.
+  [[nodiscard]] Span<const Command> add_commands(const std::vector<Command>& commands);
+
+ private:
+  StringPool m_strings{};
+  Arena<std::string_view> m_string_lists{};
+  Arena<Location> m_locations{};
+  Arena<Command::Resource> m_resources{};
+  Arena<Command> m_commands{};
+};
+
+}  // namespace Litr::Config
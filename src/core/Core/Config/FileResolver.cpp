@@ -4,6 +4,7 @@
 
 #include "FileResolver.hpp"
 
+#include "Core/Debug/AllocationTracker.hpp"
 #include "Core/Debug/Instrumentor.hpp"
 #include "Core/Environment.hpp"
 #include "Core/Log.hpp"
@@ -14,6 +15,7 @@ FileResolver::FileResolver(const std::string& cwd) : FileResolver(Path(cwd)) {}
 
 FileResolver::FileResolver(Path cwd) {
   LITR_PROFILE_FUNCTION();
+  LITR_ALLOCATION_PHASE(CONFIG_RESOLVE);
 
   do {
     LITR_PROFILE_SCOPE("Config::FileResolver > (do..while)");
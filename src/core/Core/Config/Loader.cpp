@@ -4,76 +4,153 @@
 
 #include "Loader.hpp"
 
+#include <algorithm>
 #include <deque>
 #include <utility>
 
 #include "Core/Config/CommandBuilder.hpp"
 #include "Core/Config/ParameterBuilder.hpp"
+#include "Core/Debug/AllocationTracker.hpp"
 #include "Core/Debug/Instrumentor.hpp"
 #include "Core/Error/Handler.hpp"
 #include "Core/Log.hpp"
+#include "Core/ThreadPool.hpp"
 #include "Core/Utils.hpp"
 
 namespace Litr::Config {
 
-Loader::Loader(Path file_path) : m_file_path(std::move(file_path)) {
+Loader::Loader(Path file_path, Mode mode) : m_source{std::move(file_path)} {
   LITR_PROFILE_FUNCTION();
+  LITR_ALLOCATION_PHASE(LOADER_BUILD);
 
-  TomlFileAdapter::Value config{m_file.parse(m_file_path)};
+  m_source.config = m_file.parse(m_source.file_path);
   if (Error::Handler::has_errors()) {
     return;
   }
 
-  if (config.contains("commands")) {
-    const TomlFileAdapter::Value& commands{m_file.find(config, "commands")};
-    collect_commands(commands);
+  // Included files are needed to know all root commands, even on lazy loading.
+  if (m_source.config.contains("include")) {
+    collect_includes(m_file.find(m_source.config, "include"));
+    read_includes();
   }
 
-  if (config.contains("params")) {
-    const TomlFileAdapter::Value& params{m_file.find(config, "params")};
+  if (mode == Mode::EAGER) {
+    collect_commands();
+  }
+
+  // Parameters are needed by every command, they are always loaded.
+  if (m_source.config.contains("params")) {
+    const Value& params{m_file.find(m_source.config, "params")};
     collect_params(params);
   }
+
+  if (m_source.config.contains("settings")) {
+    collect_settings(m_file.find(m_source.config, "settings"));
+  }
+
+  // Parameters of included files are added to the ones of the root file.
+  for (const Source& include : m_includes) {
+    collect_include_fields(include);
+  }
+}
+
+std::vector<Path> Loader::get_file_paths() const {
+  LITR_PROFILE_FUNCTION();
+
+  std::vector<Path> file_paths{m_source.file_path};
+  for (auto&& include : m_includes) {
+    file_paths.push_back(include.file_path);
+  }
+
+  return file_paths;
+}
+
+Loader::Commands Loader::get_commands() {
+  LITR_PROFILE_FUNCTION();
+
+  collect_commands();
+  return m_commands;
+}
+
+const Command* Loader::get_command(std::string_view name) {
+  LITR_PROFILE_FUNCTION();
+  LITR_ALLOCATION_PHASE(LOADER_BUILD);
+
+  if (m_has_all_commands) {
+    for (const Command& command : m_commands) {
+      if (command.name == name) {
+        return &command;
+      }
+    }
+    return nullptr;
+  }
+
+  const auto loaded{m_loaded_commands.find(name)};
+  if (loaded != m_loaded_commands.end()) {
+    return loaded->second;
+  }
+
+  std::vector<Command> command{};
+  const Value* commands{find_commands(m_source)};
+
+  if (commands != nullptr && commands->contains(name)) {
+    command.push_back(create_command(m_source, *commands, commands->at(name), name));
+  } else if (const Source* include{find_include(name)}; include != nullptr) {
+    command.push_back(create_namespace(*include));
+  } else {
+    return nullptr;
+  }
+
+  const Command* result{m_table.add_commands(command).data()};
+  m_loaded_commands.emplace(result->name, result);
+  return result;
 }
 
 // NOLINTNEXTLINE(misc-no-recursion)
-std::shared_ptr<Command> Loader::create_command(const TomlFileAdapter::Value& commands,
-    const TomlFileAdapter::Value& definition,
-    const std::string& name) {
+Command Loader::create_command(const Source& source,
+    const Value& commands,
+    const Value& definition,
+    std::string_view name) {
   LITR_PROFILE_FUNCTION();
 
-  CommandBuilder builder{commands, definition, name};
+  CommandBuilder builder{m_table, commands, definition, name};
+
+  // Commands of included files run where their file is, if not told otherwise.
+  if (source.is_included()) {
+    builder.add_default_directory(source.file_path.without_filename());
+  }
 
   // Simple string form
   if (definition.is_string()) {
     builder.add_script_line(definition.as_string(), definition);
-    return builder.get_result();
+    return *builder.get_result();
   }
 
   // Simple string array form
   if (definition.is_array()) {
     builder.add_script(definition);
-    return builder.get_result();
+    return *builder.get_result();
   }
 
   // From here on it needs to be a table to be valid.
   if (!definition.is_table()) {
     Error::Handler::push(
         Error::MalformedCommandError("A command can be a string or table.", commands.at(name)));
-    return builder.get_result();
+    return *builder.get_result();
   }
 
   // Collect command property names
-  std::deque<std::string> properties{};
+  std::deque<std::string_view> properties{};
   for (auto&& property : definition.as_table()) {
     properties.push_back(property.first);
   }
 
   while (!properties.empty()) {
     LITR_PROFILE_SCOPE("Config::Loader::create_command > collect_command_properties(while)");
-    const std::string property{properties.front()};
+    const std::string_view property{properties.front()};
 
     if (property == "script") {
-      const TomlFileAdapter::Value& scripts{m_file.find(definition, "script")};
+      const Value& scripts{m_file.find(definition, "script")};
 
       if (scripts.is_string()) {
         builder.add_script_line(scripts.as_string(), scripts);
@@ -102,7 +179,13 @@ std::shared_ptr<Command> Loader::create_command(const TomlFileAdapter::Value& co
     }
 
     if (property == "dir") {
-      builder.add_directory(m_file_path.without_filename());
+      builder.add_directory(source.file_path.without_filename());
+      properties.pop_front();
+      continue;
+    }
+
+    if (property == "affects") {
+      builder.add_affects(source.file_path.without_filename());
       properties.pop_front();
       continue;
     }
@@ -113,8 +196,50 @@ std::shared_ptr<Command> Loader::create_command(const TomlFileAdapter::Value& co
       continue;
     }
 
+    if (property == "inputs") {
+      builder.add_inputs();
+      properties.pop_front();
+      continue;
+    }
+
+    if (property == "cache") {
+      builder.add_cache();
+      properties.pop_front();
+      continue;
+    }
+
+    if (property == "resources") {
+      builder.add_resources();
+      properties.pop_front();
+      continue;
+    }
+
+    if (property == "nice") {
+      builder.add_nice();
+      properties.pop_front();
+      continue;
+    }
+
+    if (property == "cpus") {
+      builder.add_cpus();
+      properties.pop_front();
+      continue;
+    }
+
+    if (property == "limits") {
+      builder.add_limits();
+      properties.pop_front();
+      continue;
+    }
+
+    if (property == "timeout") {
+      builder.add_timeout();
+      properties.pop_front();
+      continue;
+    }
+
     // Collect properties that cannot directly be resolved.
-    const TomlFileAdapter::Value& value{m_file.find(definition, property)};
+    const Value& value{definition.at(property)};
     if (!value.is_table()) {
       Error::Handler::push(Error::UnknownCommandPropertyError(
           fmt::format(
@@ -125,24 +250,95 @@ std::shared_ptr<Command> Loader::create_command(const TomlFileAdapter::Value& co
     }
 
     // NOLINTNEXTLINE(misc-no-recursion)
-    builder.add_child_command(create_command(definition.as_table(), value, property));
+    builder.add_child_command(create_command(source, definition, value, property));
     properties.pop_front();
   }
 
-  return builder.get_result();
+  return *builder.get_result();
+}
+
+// NOLINTNEXTLINE(misc-no-recursion)
+Command Loader::create_namespace(const Source& source) {
+  LITR_PROFILE_FUNCTION();
+
+  CommandBuilder builder{m_table, source.config, source.config, source.name};
+
+  if (const Value* commands{find_commands(source)}; commands != nullptr) {
+    for (auto&& [name, definition] : commands->as_table()) {
+      // NOLINTNEXTLINE(misc-no-recursion)
+      builder.add_child_command(create_command(source, *commands, definition, name));
+    }
+  }
+
+  return *builder.get_result();
+}
+
+const Value* Loader::find_commands(const Source& source) const {
+  LITR_PROFILE_FUNCTION();
+
+  // Without a parsed configuration there is no table to look into.
+  if (!source.config.is_table() || !source.config.contains("commands")) {
+    return nullptr;
+  }
+
+  const Value& commands{m_file.find(source.config, "commands")};
+  return commands.is_table() ? &commands : nullptr;
+}
+
+const Loader::Source* Loader::find_include(std::string_view name) const {
+  LITR_PROFILE_FUNCTION();
+
+  for (const Source& include : m_includes) {
+    if (include.name == name) {
+      return &include;
+    }
+  }
+
+  return nullptr;
 }
 
-void Loader::collect_commands(const TomlFileAdapter::Value& commands) {
+void Loader::collect_commands() {
   LITR_PROFILE_FUNCTION();
+  LITR_ALLOCATION_PHASE(LOADER_BUILD);
+
+  if (m_has_all_commands) {
+    return;
+  }
+  m_has_all_commands = true;
+
+  const Value* commands{find_commands(m_source)};
+  std::vector<Command> root_commands{};
+
+  if (commands != nullptr) {
+    root_commands.reserve(commands->as_table().size() + m_includes.size());
+
+    for (auto&& [name, definition] : commands->as_table()) {
+      // Commands loaded on demand before are not built again, this would report errors twice.
+      const auto loaded{m_loaded_commands.find(name)};
+      if (loaded != m_loaded_commands.end()) {
+        root_commands.push_back(*loaded->second);
+        continue;
+      }
 
-  if (commands.is_table()) {
-    for (auto&& [name, definition] : commands.as_table()) {
-      m_commands.emplace_back(create_command(commands, definition, name));
+      root_commands.emplace_back(create_command(m_source, *commands, definition, name));
     }
   }
+
+  for (const Source& include : m_includes) {
+    const auto loaded{m_loaded_commands.find(include.name)};
+    if (loaded != m_loaded_commands.end()) {
+      root_commands.push_back(*loaded->second);
+      continue;
+    }
+
+    root_commands.emplace_back(create_namespace(include));
+  }
+
+  // All root commands are stored as one block, the same as children of a command.
+  m_commands = m_table.add_commands(root_commands);
 }
 
-void Loader::collect_params(const TomlFileAdapter::Value& params) {
+void Loader::collect_params(const Value& params) {
   LITR_PROFILE_FUNCTION();
 
   if (!params.is_table()) {
@@ -158,6 +354,15 @@ void Loader::collect_params(const TomlFileAdapter::Value& params) {
       continue;
     }
 
+    // Included files can define a parameter with the same name as another file.
+    const auto is_same_name{
+        [&name](const std::shared_ptr<Parameter>& param) { return param->name == name; }};
+    if (std::any_of(m_parameters.begin(), m_parameters.end(), is_same_name)) {
+      Error::Handler::push(Error::ValueAlreadyInUseError(
+          fmt::format(R"(The parameter name "{}" is already used.)", name), params.at(name)));
+      continue;
+    }
+
     // Simple string form
     if (definition.is_string()) {
       builder.add_description(definition.as_string());
@@ -181,4 +386,140 @@ void Loader::collect_params(const TomlFileAdapter::Value& params) {
   }
 }
 
+void Loader::collect_settings(const Value& settings) {
+  LITR_PROFILE_FUNCTION();
+
+  if (!settings.is_table()) {
+    Error::Handler::push(
+        Error::MalformedFileError(R"(The "settings" field can only be a table.)", settings));
+    return;
+  }
+
+  for (auto&& [name, setting] : settings.as_table()) {
+    if (name != "resources") {
+      Error::Handler::push(Error::MalformedFileError(
+          fmt::format(R"(The setting "{}" is not known.)", name), setting));
+      continue;
+    }
+
+    if (!setting.is_table()) {
+      Error::Handler::push(Error::MalformedFileError(
+          R"(The "resources" setting can only be a table of positive whole numbers.)",
+          setting));
+      continue;
+    }
+
+    for (auto&& [resource, capacity] : setting.as_table()) {
+      if (!capacity.is_integer() || capacity.as_integer() <= 0) {
+        Error::Handler::push(Error::MalformedFileError(
+            R"(The "resources" setting can only be a table of positive whole numbers.)",
+            capacity));
+        continue;
+      }
+
+      m_settings.resources.insert_or_assign(
+          std::string{resource}, static_cast<size_t>(capacity.as_integer()));
+    }
+  }
+}
+
+void Loader::collect_include_fields(const Source& include) {
+  LITR_PROFILE_FUNCTION();
+
+  if (!include.config.is_table()) {
+    return;
+  }
+
+  for (auto&& [name, value] : include.config.as_table()) {
+    // Commands are put under the namespace of the file, when building its root command.
+    if (name == "commands") {
+      continue;
+    }
+
+    if (name == "params") {
+      collect_params(value);
+      continue;
+    }
+
+    Error::Handler::push(Error::MalformedFileError(
+        fmt::format(R"(The field "{}" cannot be used in the included file "{}".)",
+            name,
+            include.file_path),
+        value));
+  }
+}
+
+void Loader::collect_includes(const Value& includes) {
+  LITR_PROFILE_FUNCTION();
+
+  if (!includes.is_array()) {
+    Error::Handler::push(Error::MalformedFileError(
+        R"(The "include" field can only be an array of strings.)", includes));
+    return;
+  }
+
+  const Path directory{m_source.file_path.without_filename()};
+  const Value* commands{find_commands(m_source)};
+
+  for (auto&& pattern : includes.as_array()) {
+    if (!pattern.is_string()) {
+      Error::Handler::push(Error::MalformedFileError(
+          R"(The "include" field can only be an array of strings.)", pattern));
+      continue;
+    }
+
+    const std::vector<Path> files{FileSystem::glob(directory, std::string{pattern.as_string()})};
+    if (files.empty()) {
+      Error::Handler::push(Error::MalformedFileError(
+          fmt::format(R"(There is no file to include for "{}".)", pattern.as_string()),
+          pattern));
+      continue;
+    }
+
+    for (auto&& file : files) {
+      // Overlapping patterns can find the same file more than once.
+      const auto is_same_file{
+          [&file](const Source& include) { return include.file_path == file; }};
+      if (std::any_of(m_includes.begin(), m_includes.end(), is_same_file)) {
+        continue;
+      }
+
+      const std::string name{file.parent_path().filename()};
+      if ((commands != nullptr && commands->contains(name)) || find_include(name) != nullptr) {
+        Error::Handler::push(Error::ValueAlreadyInUseError(
+            fmt::format(R"(The command name "{}" of the included file "{}" is already used.)",
+                name,
+                file),
+            pattern));
+        continue;
+      }
+
+      m_includes.push_back({file, {}, name});
+    }
+  }
+}
+
+void Loader::read_includes() {
+  LITR_PROFILE_FUNCTION();
+
+  if (m_includes.empty()) {
+    return;
+  }
+
+  // Reading does not report errors, so every file can be read at the same time.
+  std::vector<char> is_read(m_includes.size(), 0);
+  ThreadPool pool{std::min(ThreadPool::get_default_size(), m_includes.size() - 1)};
+  pool.run(m_includes.size(), [this, &is_read](size_t index) {
+    Source& include{m_includes[index]};
+    is_read[index] = m_file.read(include.file_path, include.config) ? 1 : 0;
+  });
+
+  // Files the reader cannot handle are parsed one after another, to keep errors in order.
+  for (size_t index{0}; index < m_includes.size(); ++index) {
+    if (is_read[index] == 0) {
+      m_includes[index].config = m_file.parse(m_includes[index].file_path);
+    }
+  }
+}
+
 }  // namespace Litr::Config
@@ -7,12 +7,17 @@
 #include <deque>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "Core/Config/Command.hpp"
+#include "Core/Config/CommandTable.hpp"
+#include "Core/Config/MappedFileAdapter.hpp"
 #include "Core/Config/Parameter.hpp"
-#include "Core/Config/TomlFileAdapter.hpp"
+#include "Core/Config/Settings.hpp"
+#include "Core/Config/Value.hpp"
 #include "Core/FileSystem.hpp"
 
 namespace Litr::Config {
@@ -22,32 +27,65 @@ namespace Litr::Config {
 //  to name this better thought.
 class Loader {
  public:
-  using Commands = std::vector<std::shared_ptr<Command>>;
+  using Commands = Span<const Command>;
   using Parameters = std::vector<std::shared_ptr<Parameter>>;
 
-  explicit Loader(Path file_path);
+  // Eager loading builds and validates every command right away. Lazy loading only
+  // builds a root command, including its child commands, once it is asked for.
+  enum class Mode { EAGER, LAZY };
 
-  [[nodiscard]] inline Commands get_commands() const {
-    return m_commands;
-  }
+  explicit Loader(Path file_path, Mode mode = Mode::EAGER);
+
+  [[nodiscard]] Commands get_commands();
+  [[nodiscard]] const Command* get_command(std::string_view name);
   [[nodiscard]] inline Parameters get_parameters() const {
     return m_parameters;
   }
+  [[nodiscard]] inline const Settings& get_settings() const {
+    return m_settings;
+  }
   [[nodiscard]] inline Path get_file_path() const {
-    return m_file_path;
+    return m_source.file_path;
   }
+  // The configuration file itself and every file it includes.
+  [[nodiscard]] std::vector<Path> get_file_paths() const;
 
  private:
-  std::shared_ptr<Command> create_command(const TomlFileAdapter::Value& commands,
-      const TomlFileAdapter::Value& definition,
-      const std::string& name);
-  void collect_commands(const TomlFileAdapter::Value& commands);
-  void collect_params(const TomlFileAdapter::Value& params);
-
-  const Path m_file_path;
-  const TomlFileAdapter m_file{};
+  // A configuration file to read commands from. Commands of included files are put
+  // under a namespace, a command named after the directory the file is in.
+  struct Source {
+    Path file_path{};
+    Value config{};
+    std::string name{};
+
+    [[nodiscard]] inline bool is_included() const {
+      return !name.empty();
+    }
+  };
+
+  Command create_command(const Source& source,
+      const Value& commands,
+      const Value& definition,
+      std::string_view name);
+  Command create_namespace(const Source& source);
+  [[nodiscard]] const Value* find_commands(const Source& source) const;
+  [[nodiscard]] const Source* find_include(std::string_view name) const;
+  void collect_commands();
+  void collect_params(const Value& params);
+  void collect_settings(const Value& settings);
+  void collect_include_fields(const Source& include);
+  void collect_includes(const Value& includes);
+  void read_includes();
+
+  const MappedFileAdapter m_file{};
+  Source m_source{};
+  std::vector<Source> m_includes{};
+  CommandTable m_table{};
   Commands m_commands{};
+  bool m_has_all_commands{false};
+  std::unordered_map<std::string_view, const Command*> m_loaded_commands{};
   Parameters m_parameters{};
+  Settings m_settings{};
 };
 
 }  // namespace Litr::Config
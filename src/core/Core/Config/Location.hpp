@@ -13,12 +13,19 @@ struct Location {
   uint32_t line{};
   uint32_t column{};
   std::string line_str{};
+  // File the location is in, empty if not known.
+  std::string file{};
 
   Location() = default;
   Location(uint32_t line, uint32_t column, std::string lineStr)
       : line(line),
         column(column),
         line_str(std::move(lineStr)) {}
+  Location(uint32_t line, uint32_t column, std::string lineStr, std::string file)
+      : line(line),
+        column(column),
+        line_str(std::move(lineStr)),
+        file(std::move(file)) {}
 };
 
 }  // namespace Litr::Config
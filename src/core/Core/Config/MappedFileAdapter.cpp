@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "MappedFileAdapter.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "Core/Config/TomlFileAdapter.hpp"
+#include "Core/Config/TomlReader.hpp"
+#include "Core/Debug/AllocationTracker.hpp"
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/StringPool.hpp"
+
+namespace Litr::Config {
+
+/** @private */
+struct SourceStorage {
+  explicit SourceStorage(std::string source) : source(std::move(source)) {}
+
+  std::string source;
+  StringPool strings{};
+};
+
+/** @private */
+static bool read_file(const Path& file_path, std::string& contents) {
+  std::error_code error{};
+  if (!std::filesystem::is_regular_file(file_path.to_string(), error)) {
+    return false;
+  }
+
+  std::ifstream file{file_path.to_string(), std::ios::binary | std::ios::ate};
+  const std::streamoff size{file.tellg()};
+  if (!file || size < 0) {
+    return false;
+  }
+
+  // A file written in between may have become shorter, only what was read is kept.
+  contents.resize(static_cast<size_t>(size));
+  file.seekg(0);
+  file.read(contents.data(), size);
+  contents.resize(static_cast<size_t>(file.gcount()));
+  return true;
+}
+
+MappedFileAdapter::Value MappedFileAdapter::parse(const Path& file_path) const {
+  LITR_PROFILE_FUNCTION();
+  LITR_ALLOCATION_PHASE(TOML_PARSE);
+
+  Value root{};
+  if (read(file_path, root)) {
+    return root;
+  }
+
+  return TomlFileAdapter{}.parse(file_path);
+}
+
+bool MappedFileAdapter::read(const Path& file_path, Value& root) const {
+  LITR_PROFILE_FUNCTION();
+  LITR_ALLOCATION_PHASE(TOML_PARSE);
+
+  // Values are views into the source, they must not change with the file while loading
+  // lazily or watching it. The file is read into storage of its own instead of mapped.
+  auto storage{std::make_shared<SourceStorage>(std::string{})};
+  if (!read_file(file_path, storage->source)) {
+    return false;
+  }
+
+  const std::string_view file_name{storage->strings.intern(file_path.to_string())};
+  TomlReader reader{storage->source, storage->strings, file_name};
+
+  if (!reader.read(root)) {
+    return false;
+  }
+
+  root.m_storage = std::move(storage);
+  return true;
+}
+
+MappedFileAdapter::Value MappedFileAdapter::parse_source(std::string source) const {
+  LITR_PROFILE_FUNCTION();
+  LITR_ALLOCATION_PHASE(TOML_PARSE);
+
+  auto storage{std::make_shared<SourceStorage>(std::move(source))};
+
+  Value root{};
+  TomlReader reader{storage->source, storage->strings};
+
+  if (reader.read(root)) {
+    root.m_storage = std::move(storage);
+    return root;
+  }
+
+  return TomlFileAdapter{}.parse_source(storage->source);
+}
+
+const MappedFileAdapter::Value& MappedFileAdapter::find(
+    const MappedFileAdapter::Value& value, const std::string& key) const {
+  LITR_PROFILE_FUNCTION();
+
+  return value.at(key);
+}
+
+}  // namespace Litr::Config
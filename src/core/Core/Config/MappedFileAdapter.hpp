@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <string>
+
+#include "Core/Config/FileAdapter.hpp"
+#include "Core/Config/Value.hpp"
+
+namespace Litr::Config {
+
+// Reads configurations with the `TomlReader` out of the file read into memory once. Files it
+// cannot read are handed to the `TomlFileAdapter`, that also reports all syntax errors.
+class MappedFileAdapter : public FileAdapter<Value> {
+ public:
+  [[nodiscard]] Value parse(const Path& file_path) const override;
+  // Reads a file without falling back or reporting errors, it is safe to call from any thread.
+  [[nodiscard]] bool read(const Path& file_path, Value& root) const;
+  [[nodiscard]] Value parse_source(std::string source) const;
+
+  [[nodiscard]] const Value& find(const Value& value, const std::string& key) const override;
+};
+
+}  // namespace Litr::Config
@@ -4,18 +4,17 @@
 
 #include "ParameterBuilder.hpp"
 
+#include "Core/CLI/Options.hpp"
 #include "Core/Debug/Instrumentor.hpp"
 #include "Core/Error/Handler.hpp"
 #include "Core/Log.hpp"
 
 namespace Litr::Config {
 
-ParameterBuilder::ParameterBuilder(const TomlFileAdapter::Value& context,
-    const TomlFileAdapter::Value& data,
-    const std::string& name)
+ParameterBuilder::ParameterBuilder(const Value& context, const Value& data, std::string_view name)
     : m_context(context),
       m_table(data),
-      m_parameter(std::make_shared<Parameter>(name)) {
+      m_parameter(std::make_shared<Parameter>(std::string{name})) {
   LITR_CORE_TRACE("Creating {}", *m_parameter);
 }
 
@@ -30,7 +29,7 @@ void ParameterBuilder::add_description() {
     return;
   }
 
-  const TomlFileAdapter::Value& description{m_file.find(m_table, name)};
+  const Value& description{m_file.find(m_table, name)};
 
   if (!description.is_string()) {
     Error::Handler::push(Error::MalformedParamError(
@@ -41,7 +40,7 @@ void ParameterBuilder::add_description() {
   m_parameter->description = description.as_string();
 }
 
-void ParameterBuilder::add_description(const std::string& description) {
+void ParameterBuilder::add_description(std::string_view description) {
   LITR_PROFILE_FUNCTION();
 
   m_parameter->description = description;
@@ -57,7 +56,7 @@ void ParameterBuilder::add_shortcut(const std::vector<std::shared_ptr<Parameter>
   const std::string name{"shortcut"};
 
   if (m_table.contains(name)) {
-    const TomlFileAdapter::Value& shortcut{m_file.find(m_table, name)};
+    const Value& shortcut{m_file.find(m_table, name)};
 
     if (shortcut.is_string()) {
       const std::string shortcut_str{shortcut.as_string()};
@@ -95,7 +94,7 @@ void ParameterBuilder::add_type() {
   const std::string name{"type"};
 
   if (m_table.contains(name)) {
-    const TomlFileAdapter::Value& type{m_file.find(m_table, name)};
+    const Value& type{m_file.find(m_table, name)};
 
     if (type.is_string()) {
       if (type.as_string() == "string") {
@@ -107,9 +106,7 @@ void ParameterBuilder::add_type() {
             fmt::format(
                 R"(The "{}" option as string can only be "string" or "boolean". Provided value "{}" is not known.)",
                 name,
-                // @todo: Looking at this I'm confused why I have to do this. Needs some
-                // investigation.
-                static_cast<std::string>(type.as_string())),
+                type.as_string()),
             m_table.at(name)));
       }
       return;
@@ -141,7 +138,7 @@ void ParameterBuilder::add_default() {
   const std::string name{"default"};
 
   if (m_table.contains(name)) {
-    const TomlFileAdapter::Value& def{m_file.find(m_table, name)};
+    const Value& def{m_file.find(m_table, name)};
 
     if (def.is_string()) {
       const std::string default_value{def.as_string()};
@@ -169,11 +166,11 @@ void ParameterBuilder::add_default() {
   }
 }
 
-bool ParameterBuilder::is_reserved_name(const std::string& name) {
+bool ParameterBuilder::is_reserved_name(std::string_view name) {
   LITR_PROFILE_FUNCTION();
 
   // @todo: Could help and version be closer to the hooks?
-  const std::array<std::string, 6> reserved{
+  const std::array<std::string_view, 6> reserved{
       // Those are reserved to not collide with the built-in help
       "help",
       "h",
@@ -183,7 +180,8 @@ bool ParameterBuilder::is_reserved_name(const std::string& name) {
       // Those are reserved for script functionality
       "or",
       "and"};
-  return std::find(reserved.begin(), reserved.end(), name) != reserved.end();
+  return std::find(reserved.begin(), reserved.end(), name) != reserved.end() ||
+         CLI::Options::is_builtin(name);
 }
 
 }  // namespace Litr::Config
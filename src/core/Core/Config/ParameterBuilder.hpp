@@ -6,21 +6,21 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "Core/Config/MappedFileAdapter.hpp"
 #include "Core/Config/Parameter.hpp"
-#include "Core/Config/TomlFileAdapter.hpp"
+#include "Core/Config/Value.hpp"
 
 namespace Litr::Config {
 
 class ParameterBuilder {
  public:
-  ParameterBuilder(const TomlFileAdapter::Value& context,
-      const TomlFileAdapter::Value& data,
-      const std::string& name);
+  ParameterBuilder(const Value& context, const Value& data, std::string_view name);
 
   void add_description();
-  void add_description(const std::string& description);
+  void add_description(std::string_view description);
   void add_shortcut();
   void add_shortcut(const std::vector<std::shared_ptr<Parameter>>& params);
   void add_default();
@@ -30,13 +30,13 @@ class ParameterBuilder {
     return m_parameter;
   }
 
-  [[nodiscard]] static bool is_reserved_name(const std::string& name);
+  [[nodiscard]] static bool is_reserved_name(std::string_view name);
 
  private:
-  const TomlFileAdapter::Value& m_context;
-  const TomlFileAdapter::Value& m_table;
+  const Value& m_context;
+  const Value& m_table;
   const std::shared_ptr<Parameter> m_parameter;
-  const TomlFileAdapter m_file{};
+  const MappedFileAdapter m_file{};
 };
 
 }  // namespace Litr::Config
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 
+#include "Core/Debug/AllocationTracker.hpp"
 #include "Core/Debug/Instrumentor.hpp"
 #include "Core/Script/Compiler.hpp"
 #include "Core/Utils.hpp"
@@ -14,15 +15,29 @@ namespace Litr::Config {
 
 Query::Query(const std::shared_ptr<Loader>& config) : m_config(config) {}
 
-std::shared_ptr<Command> Query::get_command(const std::string& name) const {
+const Command* Query::get_command(std::string_view name) const {
   LITR_PROFILE_FUNCTION();
+  LITR_ALLOCATION_PHASE(QUERY);
 
   Parts names{split_command_query(name)};
-  return get_command_by_path(names, get_commands());
+  if (names.empty()) {
+    return nullptr;
+  }
+
+  // Only the root command of the path is asked for, so a lazy loader does not build all.
+  const Command* command{m_config->get_command(names.front())};
+  names.pop_front();
+
+  if (command == nullptr || names.empty()) {
+    return command;
+  }
+
+  return get_command_by_path(names, command->child_commands);
 }
 
-std::shared_ptr<Parameter> Query::get_parameter(const std::string& name) const {
+std::shared_ptr<Parameter> Query::get_parameter(std::string_view name) const {
   LITR_PROFILE_FUNCTION();
+  LITR_ALLOCATION_PHASE(QUERY);
 
   for (auto&& param : get_parameters()) {
     if (param->name == name || param->shortcut == name) {
@@ -35,14 +50,16 @@ std::shared_ptr<Parameter> Query::get_parameter(const std::string& name) const {
 
 Query::Commands Query::get_commands() const {
   LITR_PROFILE_FUNCTION();
+  LITR_ALLOCATION_PHASE(QUERY);
 
   return m_config->get_commands();
 }
 
-Query::Commands Query::get_commands(const std::string& name) const {
+Query::Commands Query::get_commands(std::string_view name) const {
   LITR_PROFILE_FUNCTION();
+  LITR_ALLOCATION_PHASE(QUERY);
 
-  const std::shared_ptr<Command>& command{get_command(name)};
+  const Command* command{get_command(name)};
 
   if (command == nullptr) {
     return {};
@@ -53,21 +70,23 @@ Query::Commands Query::get_commands(const std::string& name) const {
 
 Query::Parameters Query::get_parameters() const {
   LITR_PROFILE_FUNCTION();
+  LITR_ALLOCATION_PHASE(QUERY);
 
   return m_config->get_parameters();
 }
 
-Query::Parameters Query::get_parameters(const std::string& command_name) const {
+Query::Parameters Query::get_parameters(std::string_view command_name) const {
   LITR_PROFILE_FUNCTION();
+  LITR_ALLOCATION_PHASE(QUERY);
 
-  const std::shared_ptr<Command>& command{get_command(command_name)};
+  const Command* command{get_command(command_name)};
   Query::Parameters parameters{};
 
   if (command == nullptr) {
     return parameters;
   }
 
-  std::vector<std::string> names{get_used_parameter_names(command)};
+  std::vector<std::string> names{get_used_parameter_names(*command)};
 
   for (auto&& child_command : command->child_commands) {
     const std::vector<std::string> child_names{get_used_parameter_names(child_command)};
@@ -85,7 +104,7 @@ Query::Parameters Query::get_parameters(const std::string& command_name) const {
   return parameters;
 }
 
-Query::Parts Query::split_command_query(const std::string& query) {
+Query::Parts Query::split_command_query(std::string_view query) {
   LITR_PROFILE_FUNCTION();
 
   Parts parts{};
@@ -94,11 +113,10 @@ Query::Parts Query::split_command_query(const std::string& query) {
 }
 
 // NOLINTNEXTLINE(misc-no-recursion)
-std::shared_ptr<Command> Query::get_command_by_path(
-    Parts& names, const Loader::Commands& commands) {
+const Command* Query::get_command_by_path(Parts& names, Commands commands) {
   LITR_PROFILE_FUNCTION();
 
-  const std::shared_ptr<Command>& command{get_command_by_name(names.front(), commands)};
+  const Command* command{get_command_by_name(names.front(), commands)};
 
   if (command == nullptr) {
     return nullptr;
@@ -123,13 +141,12 @@ std::shared_ptr<Command> Query::get_command_by_path(
   return get_command_by_path(names, command->child_commands);
 }
 
-std::shared_ptr<Command> Query::get_command_by_name(
-    const std::string& name, const Loader::Commands& commands) {
+const Command* Query::get_command_by_name(std::string_view name, Commands commands) {
   LITR_PROFILE_FUNCTION();
 
-  for (const std::shared_ptr<Command>& command : commands) {
-    if (command->name == name) {
-      return command;
+  for (const Command& command : commands) {
+    if (command.name == name) {
+      return &command;
     }
   }
 
@@ -149,16 +166,15 @@ Query::Variables Query::get_parameters_as_variables() const {
   return variables;
 }
 
-std::vector<std::string> Query::get_used_parameter_names(
-    const std::shared_ptr<Command>& command) const {
+std::vector<std::string> Query::get_used_parameter_names(const Command& command) const {
   LITR_PROFILE_FUNCTION();
 
   std::vector<std::string> names{};
   size_t index{0};
 
-  for (auto&& script : command->script) {
+  for (auto&& script : command.script) {
     const Variables variables{get_parameters_as_variables()};
-    const Script::Compiler compiler{script, command->Locations[index++], variables};
+    const Script::Compiler compiler{std::string{script}, command.Locations[index++], variables};
     const std::vector<std::string> used_names{compiler.get_used_variables()};
     names.insert(names.end(), used_names.begin(), used_names.end());
   }
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+namespace Litr::Config {
+
+// Defined once in the `[settings]` table of a configuration file, for all commands.
+struct Settings {
+  // How much of a resource all commands running at the same time can take together.
+  std::unordered_map<std::string, size_t> resources{};
+};
+
+}  // namespace Litr::Config
@@ -4,6 +4,10 @@
 
 #include "TomlFileAdapter.hpp"
 
+#include <memory>
+#include <sstream>
+
+#include "Core/Debug/AllocationTracker.hpp"
 #include "Core/Debug/Instrumentor.hpp"
 #include "Core/Error/Handler.hpp"
 
@@ -11,29 +15,96 @@ namespace Litr::Config {
 
 TomlFileAdapter::Value TomlFileAdapter::parse(const Path& file_path) const {
   LITR_PROFILE_FUNCTION();
+  LITR_ALLOCATION_PHASE(TOML_PARSE);
 
-  TomlFileAdapter::Value config{};
+  BasicTomlValue config{};
 
   try {
     config = toml::parse<toml::discard_comments, tsl::ordered_map>(file_path.to_string());
   } catch (const toml::syntax_error& err) {
     Error::Handler::push(
         Error::MalformedFileError("There is a syntax error inside the configuration file.", err));
-    return config;
+    return {};
   }
 
   if (!config.is_table()) {
     Error::Handler::push(Error::MalformedFileError("Configuration is not a TOML table."));
   }
 
-  return config;
+  return convert(config, file_path.to_string());
+}
+
+TomlFileAdapter::Value TomlFileAdapter::parse_source(const std::string& source) const {
+  LITR_PROFILE_FUNCTION();
+  LITR_ALLOCATION_PHASE(TOML_PARSE);
+
+  std::istringstream stream{source};
+  BasicTomlValue config{};
+
+  try {
+    config = toml::parse<toml::discard_comments, tsl::ordered_map>(stream, "std::string");
+  } catch (const toml::syntax_error& err) {
+    Error::Handler::push(
+        Error::MalformedFileError("There is a syntax error inside the configuration file.", err));
+    return {};
+  }
+
+  return convert(config, "");
 }
 
 const TomlFileAdapter::Value& TomlFileAdapter::find(
     const TomlFileAdapter::Value& value, const std::string& key) const {
   LITR_PROFILE_FUNCTION();
 
-  return toml::find(value, key);
+  return value.at(key);
+}
+
+TomlFileAdapter::Value TomlFileAdapter::convert(
+    const BasicTomlValue& toml_value, const std::string& file_name) {
+  LITR_PROFILE_FUNCTION();
+
+  // All strings of the converted values live as long as the root value does.
+  auto strings{std::make_shared<StringPool>()};
+  Value root{convert(toml_value, *strings, strings->intern(file_name))};
+  root.m_storage = strings;
+  return root;
+}
+
+// NOLINTNEXTLINE(misc-no-recursion)
+TomlFileAdapter::Value TomlFileAdapter::convert(
+    const BasicTomlValue& toml_value, StringPool& strings, std::string_view file_name) {
+  const auto source_location{toml_value.location()};
+  const Value::SourceLocation location{static_cast<uint32_t>(source_location.line()),
+      static_cast<uint32_t>(source_location.column()),
+      strings.intern(source_location.line_str()),
+      file_name};
+
+  if (toml_value.is_string()) {
+    return {strings.intern(static_cast<const std::string&>(toml_value.as_string())), location};
+  }
+
+  if (toml_value.is_integer()) {
+    return {static_cast<int64_t>(toml_value.as_integer()), location};
+  }
+
+  if (toml_value.is_array()) {
+    Value array{Value::Type::ARRAY, location};
+    for (auto&& element : toml_value.as_array()) {
+      array.m_array.push_back(convert(element, strings, file_name));  // NOLINT(misc-no-recursion)
+    }
+    return array;
+  }
+
+  if (toml_value.is_table()) {
+    Value table{Value::Type::TABLE, location};
+    for (auto&& [key, element] : toml_value.as_table()) {
+      // NOLINTNEXTLINE(misc-no-recursion)
+      table.m_table.emplace_back(strings.intern(key), convert(element, strings, file_name));
+    }
+    return table;
+  }
+
+  return {Value::Type::OTHER, location};
 }
 
 }  // namespace Litr::Config
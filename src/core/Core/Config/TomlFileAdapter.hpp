@@ -6,21 +6,34 @@
 
 #include <tsl/ordered_map.h>
 
+#include <string>
+#include <string_view>
 #include <toml.hpp>
 
 #include "Core/Config/FileAdapter.hpp"
+#include "Core/Config/Value.hpp"
+#include "Core/StringPool.hpp"
 
 namespace Litr::Config {
 
 using BasicTomlValue = toml::basic_value<toml::discard_comments, tsl::ordered_map>;
 
-class TomlFileAdapter : public FileAdapter<BasicTomlValue> {
+// Parses configurations with the complete TOML parser. It handles everything the
+// `TomlReader` does not support and reports syntax errors in detail.
+class TomlFileAdapter : public FileAdapter<Value> {
  public:
   using Exception = toml::exception;
 
   [[nodiscard]] Value parse(const Path& file_path) const override;
+  [[nodiscard]] Value parse_source(const std::string& source) const;
 
   [[nodiscard]] const Value& find(const Value& value, const std::string& key) const override;
+
+ private:
+  [[nodiscard]] static Value convert(
+      const BasicTomlValue& toml_value, const std::string& file_name);
+  [[nodiscard]] static Value convert(
+      const BasicTomlValue& toml_value, StringPool& strings, std::string_view file_name);
 };
 
 }  // namespace Litr::Config
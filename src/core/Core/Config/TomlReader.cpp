@@ -0,0 +1,814 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "TomlReader.hpp"
+
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "Core/Debug/Instrumentor.hpp"
+
+namespace Litr::Config {
+
+/** @private */
+static bool append_code_point(uint32_t code_point, std::string& string) {
+  // Surrogates and anything above the Unicode range are not valid scalar values.
+  if ((code_point >= 0xD800 && code_point <= 0xDFFF) || code_point > 0x10FFFF) {
+    return false;
+  }
+
+  if (code_point < 0x80) {
+    string.push_back(static_cast<char>(code_point));
+  } else if (code_point < 0x800) {
+    string.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+    string.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  } else if (code_point < 0x10000) {
+    string.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+    string.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+    string.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  } else {
+    string.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+    string.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+    string.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+    string.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  }
+
+  return true;
+}
+
+/** @private */
+static bool read_hex(std::string_view digits, uint32_t& value) {
+  value = 0;
+  for (const char digit : digits) {
+    value <<= 4U;
+    if (digit >= '0' && digit <= '9') {
+      value |= static_cast<uint32_t>(digit - '0');
+    } else if (digit >= 'a' && digit <= 'f') {
+      value |= static_cast<uint32_t>(digit - 'a' + 10);
+    } else if (digit >= 'A' && digit <= 'F') {
+      value |= static_cast<uint32_t>(digit - 'A' + 10);
+    } else {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/** @private */
+static bool is_whitespace(char character) {
+  return character == ' ' || character == '\t';
+}
+
+TomlReader::TomlReader(std::string_view source, StringPool& strings, std::string_view file_name)
+    : m_current(source.data()),
+      m_end(source.data() + source.size()),
+      m_line_start(source.data()),
+      m_file_name(file_name),
+      m_strings(strings) {}
+
+size_t TomlReader::KeyHash::operator()(const Key& key) const {
+  // Combined the same way as `boost::hash_combine` does.
+  const size_t hash{std::hash<std::string_view>{}(key.name)};
+  return hash ^ (key.table + 0x9e3779b9 + (hash << 6U) + (hash >> 2U));
+}
+
+bool TomlReader::read(Value& root) {
+  LITR_PROFILE_FUNCTION();
+
+  root = Value{Value::Type::TABLE, location()};
+
+  // A byte order mark is left to the complete parser.
+  if (starts_with("\xEF\xBB\xBF")) {
+    return false;
+  }
+
+  Value* table{&root};
+  size_t table_id{0};
+
+  while (!is_at_end()) {
+    skip_whitespace();
+
+    switch (peek()) {
+      case '\0': {
+        if (!is_at_end()) {
+          return false;
+        }
+        break;
+      }
+      case '#':
+      case '\r':
+      case '\n': {
+        if (!end_of_line()) {
+          return false;
+        }
+        break;
+      }
+      case '[': {
+        if (!table_header(root, table, table_id)) {
+          return false;
+        }
+        break;
+      }
+      default: {
+        if (!key_value(*table, table_id)) {
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+bool TomlReader::table_header(Value& root, Value*& table, size_t& table_id) {
+  LITR_PROFILE_FUNCTION();
+
+  ++m_current;
+
+  // Arrays of tables are not supported.
+  if (peek() == '[') {
+    return false;
+  }
+
+  skip_whitespace();
+  const Value::SourceLocation header_location{location()};
+
+  table = &root;
+  table_id = 0;
+
+  for (;;) {
+    std::string_view name{};
+    if (!key(name)) {
+      return false;
+    }
+
+    skip_whitespace();
+    const bool is_last{peek() != '.'};
+
+    const auto existing{m_keys.find({table_id, name})};
+    if (existing == m_keys.end()) {
+      table->m_table.emplace_back(name, Value{Value::Type::TABLE, header_location});
+      const Definition definition{table->m_table.size() - 1,
+          ++m_table_count,
+          is_last ? Definition::Kind::TABLE : Definition::Kind::IMPLICIT_TABLE};
+      m_keys.emplace(Key{table_id, name}, definition);
+
+      table = &table->m_table.back().second;
+      table_id = definition.table;
+    } else {
+      Definition& definition{existing->second};
+
+      // Values cannot be extended and a table can only be defined once.
+      if (definition.kind == Definition::Kind::VALUE ||
+          (is_last && definition.kind == Definition::Kind::TABLE)) {
+        return false;
+      }
+
+      table = &table->m_table[definition.index].second;
+      table_id = definition.table;
+
+      if (is_last) {
+        definition.kind = Definition::Kind::TABLE;
+        table->m_location = header_location;
+      }
+    }
+
+    if (is_last) {
+      break;
+    }
+
+    ++m_current;
+    skip_whitespace();
+  }
+
+  if (peek() != ']') {
+    return false;
+  }
+  ++m_current;
+
+  return end_of_line();
+}
+
+bool TomlReader::key_value(Value& table, size_t table_id) {
+  LITR_PROFILE_FUNCTION();
+
+  std::string_view name{};
+  if (!key(name)) {
+    return false;
+  }
+
+  // This also rejects dotted keys, those are not supported.
+  skip_whitespace();
+  if (peek() != '=') {
+    return false;
+  }
+  ++m_current;
+  skip_whitespace();
+
+  if (m_keys.find({table_id, name}) != m_keys.end()) {
+    return false;
+  }
+
+  Value result{};
+  if (!value(result, 0) || !end_of_line()) {
+    return false;
+  }
+
+  table.m_table.emplace_back(name, std::move(result));
+  m_keys.emplace(Key{table_id, name},
+      Definition{table.m_table.size() - 1, 0, Definition::Kind::VALUE});
+  return true;
+}
+
+bool TomlReader::key(std::string_view& name) {
+  if (peek() == '"') {
+    return basic_string(name);
+  }
+
+  if (peek() == '\'') {
+    return literal_string(name);
+  }
+
+  const char* start{m_current};
+  while (!is_at_end() && is_bare_key(*m_current)) {
+    ++m_current;
+  }
+
+  name = {start, static_cast<size_t>(m_current - start)};
+  return !name.empty();
+}
+
+// NOLINTNEXTLINE(misc-no-recursion)
+bool TomlReader::value(Value& value, size_t depth) {
+  const Value::SourceLocation value_location{location()};
+  std::string_view string{};
+
+  switch (peek()) {
+    case '"': {
+      if (!(starts_with(R"(""")") ? multi_line_basic_string(string) : basic_string(string))) {
+        return false;
+      }
+      value = Value{string, value_location};
+      return true;
+    }
+    case '\'': {
+      if (!(starts_with("'''") ? multi_line_literal_string(string) : literal_string(string))) {
+        return false;
+      }
+      value = Value{string, value_location};
+      return true;
+    }
+    case '[': {
+      value = Value{Value::Type::ARRAY, value_location};
+      return array(value, depth);  // NOLINT(misc-no-recursion)
+    }
+    case '{': {
+      value = Value{Value::Type::TABLE, value_location};
+      return inline_table(value, depth);  // NOLINT(misc-no-recursion)
+    }
+    case 't':
+    case 'f': {
+      // Booleans are not used for anything but still need to be known.
+      value = Value{Value::Type::OTHER, value_location};
+      return keyword("true") || keyword("false");
+    }
+    case '+':
+    case '-':
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+    case '8':
+    case '9': {
+      int64_t number{0};
+      if (!integer(number)) {
+        return false;
+      }
+      value = Value{number, value_location};
+      return true;
+    }
+    default: {
+      return false;
+    }
+  }
+}
+
+bool TomlReader::basic_string(std::string_view& string) {
+  ++m_current;
+  const char* start{m_current};
+  bool has_escapes{false};
+
+  for (;;) {
+    if (is_at_end() || is_control(*m_current)) {
+      return false;
+    }
+
+    if (*m_current == '"') {
+      break;
+    }
+
+    if (*m_current == '\\') {
+      // The escaped character is checked when unescaping.
+      if (m_end - m_current < 2) {
+        return false;
+      }
+      has_escapes = true;
+      ++m_current;
+    }
+
+    ++m_current;
+  }
+
+  const std::string_view raw{start, static_cast<size_t>(m_current - start)};
+  ++m_current;
+
+  if (!has_escapes) {
+    string = raw;
+    return true;
+  }
+
+  return unescape(raw, false, string);
+}
+
+bool TomlReader::multi_line_basic_string(std::string_view& string) {
+  LITR_PROFILE_FUNCTION();
+
+  m_current += 3;
+
+  // A newline right after the opening delimiter is not part of the string.
+  if ((peek() == '\n' || peek() == '\r') && !newline()) {
+    return false;
+  }
+
+  const char* start{m_current};
+  bool has_escapes{false};
+
+  for (;;) {
+    if (is_at_end()) {
+      return false;
+    }
+
+    const char character{*m_current};
+
+    if (character == '"' && starts_with(R"(""")")) {
+      // Up to two quotation marks can be part of the string, right before the delimiter.
+      size_t quotes{3};
+      while (m_current + quotes < m_end && m_current[quotes] == '"') {
+        ++quotes;
+      }
+      if (quotes > 5) {
+        return false;
+      }
+
+      const std::string_view raw{start, static_cast<size_t>(m_current - start) + quotes - 3};
+      m_current += quotes;
+
+      if (!has_escapes) {
+        string = raw;
+        return true;
+      }
+
+      return unescape(raw, true, string);
+    }
+
+    if (character == '\n' || character == '\r') {
+      if (!newline()) {
+        return false;
+      }
+      continue;
+    }
+
+    if (is_control(character)) {
+      return false;
+    }
+
+    if (character == '\\') {
+      if (m_end - m_current < 2) {
+        return false;
+      }
+      has_escapes = true;
+
+      // A line ending backslash keeps the newline to be counted as such.
+      if (m_current[1] != '\n' && m_current[1] != '\r') {
+        ++m_current;
+      }
+    }
+
+    ++m_current;
+  }
+}
+
+bool TomlReader::literal_string(std::string_view& string) {
+  ++m_current;
+  const char* start{m_current};
+
+  while (!is_at_end() && *m_current != '\'') {
+    if (is_control(*m_current)) {
+      return false;
+    }
+    ++m_current;
+  }
+
+  if (is_at_end()) {
+    return false;
+  }
+
+  string = {start, static_cast<size_t>(m_current - start)};
+  ++m_current;
+  return true;
+}
+
+bool TomlReader::multi_line_literal_string(std::string_view& string) {
+  LITR_PROFILE_FUNCTION();
+
+  m_current += 3;
+
+  // A newline right after the opening delimiter is not part of the string.
+  if ((peek() == '\n' || peek() == '\r') && !newline()) {
+    return false;
+  }
+
+  const char* start{m_current};
+
+  for (;;) {
+    if (is_at_end()) {
+      return false;
+    }
+
+    const char character{*m_current};
+
+    if (character == '\'' && starts_with("'''")) {
+      // Up to two apostrophes can be part of the string, right before the delimiter.
+      size_t quotes{3};
+      while (m_current + quotes < m_end && m_current[quotes] == '\'') {
+        ++quotes;
+      }
+      if (quotes > 5) {
+        return false;
+      }
+
+      string = {start, static_cast<size_t>(m_current - start) + quotes - 3};
+      m_current += quotes;
+      return true;
+    }
+
+    if (character == '\n' || character == '\r') {
+      if (!newline()) {
+        return false;
+      }
+      continue;
+    }
+
+    if (is_control(character)) {
+      return false;
+    }
+
+    ++m_current;
+  }
+}
+
+bool TomlReader::unescape(std::string_view raw, bool multi_line, std::string_view& string) {
+  LITR_PROFILE_FUNCTION();
+
+  std::string unescaped{};
+  unescaped.reserve(raw.size());
+
+  for (size_t index{0}; index < raw.size(); ++index) {
+    if (raw[index] != '\\') {
+      unescaped.push_back(raw[index]);
+      continue;
+    }
+
+    ++index;
+    const char character{raw[index]};
+    uint32_t code_point{0};
+
+    switch (character) {
+      case 'b':
+        unescaped.push_back('\b');
+        break;
+      case 't':
+        unescaped.push_back('\t');
+        break;
+      case 'n':
+        unescaped.push_back('\n');
+        break;
+      case 'f':
+        unescaped.push_back('\f');
+        break;
+      case 'r':
+        unescaped.push_back('\r');
+        break;
+      case '"':
+      case '\\':
+        unescaped.push_back(character);
+        break;
+      case 'u':
+      case 'U': {
+        const size_t length{character == 'u' ? 4U : 8U};
+        if (index + length >= raw.size() + 1 ||
+            !read_hex(raw.substr(index + 1, length), code_point) ||
+            !append_code_point(code_point, unescaped)) {
+          return false;
+        }
+        index += length;
+        break;
+      }
+      default: {
+        // A line ending backslash removes all whitespace up to the next content.
+        if (!multi_line || !(is_whitespace(character) || character == '\n' || character == '\r')) {
+          return false;
+        }
+
+        size_t next{index};
+        while (next < raw.size() && is_whitespace(raw[next])) {
+          ++next;
+        }
+        if (next == raw.size() || (raw[next] != '\n' && raw[next] != '\r')) {
+          return false;
+        }
+        while (next < raw.size() &&
+               (is_whitespace(raw[next]) || raw[next] == '\n' || raw[next] == '\r')) {
+          ++next;
+        }
+        index = next - 1;
+      }
+    }
+  }
+
+  string = m_strings.intern(unescaped);
+  return true;
+}
+
+// NOLINTNEXTLINE(misc-no-recursion)
+bool TomlReader::array(Value& array, size_t depth) {
+  if (depth >= max_depth) {
+    return false;
+  }
+
+  ++m_current;
+
+  for (;;) {
+    if (!skip_blank()) {
+      return false;
+    }
+
+    if (peek() == ']') {
+      ++m_current;
+      return true;
+    }
+
+    Value element{};
+    if (!value(element, depth + 1) || !skip_blank()) {  // NOLINT(misc-no-recursion)
+      return false;
+    }
+    array.m_array.push_back(std::move(element));
+
+    if (peek() == ',') {
+      ++m_current;
+      continue;
+    }
+
+    if (peek() == ']') {
+      ++m_current;
+      return true;
+    }
+
+    return false;
+  }
+}
+
+// NOLINTNEXTLINE(misc-no-recursion)
+bool TomlReader::inline_table(Value& table, size_t depth) {
+  if (depth >= max_depth) {
+    return false;
+  }
+
+  ++m_current;
+  skip_whitespace();
+
+  if (peek() == '}') {
+    ++m_current;
+    return true;
+  }
+
+  for (;;) {
+    std::string_view name{};
+    if (!key(name)) {
+      return false;
+    }
+
+    skip_whitespace();
+    if (peek() != '=' || table.contains(name)) {
+      return false;
+    }
+    ++m_current;
+    skip_whitespace();
+
+    Value result{};
+    if (!value(result, depth + 1)) {  // NOLINT(misc-no-recursion)
+      return false;
+    }
+    table.m_table.emplace_back(name, std::move(result));
+
+    // Inline tables are on a single line and cannot end with a comma.
+    skip_whitespace();
+    if (peek() == ',') {
+      ++m_current;
+      skip_whitespace();
+      continue;
+    }
+
+    if (peek() == '}') {
+      ++m_current;
+      return true;
+    }
+
+    return false;
+  }
+}
+
+bool TomlReader::keyword(std::string_view word) {
+  if (!starts_with(word)) {
+    return false;
+  }
+
+  const char* end{m_current + word.size()};
+  if (end < m_end && is_bare_key(*end)) {
+    return false;
+  }
+
+  m_current = end;
+  return true;
+}
+
+bool TomlReader::integer(int64_t& number) {
+  // A sign and the longest 64-bit number, without the underscores separating digits.
+  constexpr size_t max_length{20};
+  std::array<char, max_length> digits{};
+  size_t length{0};
+
+  if (peek() == '+' || peek() == '-') {
+    if (*m_current == '-') {
+      digits.at(length++) = '-';
+    }
+    ++m_current;
+  }
+
+  const size_t first_digit{length};
+  bool is_after_digit{false};
+
+  while (!is_at_end() && (std::isdigit(static_cast<unsigned char>(*m_current)) != 0 ||
+                            *m_current == '_')) {
+    if (*m_current == '_') {
+      if (!is_after_digit) {
+        return false;
+      }
+      is_after_digit = false;
+    } else {
+      if (length == max_length) {
+        return false;
+      }
+      digits.at(length++) = *m_current;
+      is_after_digit = true;
+    }
+    ++m_current;
+  }
+
+  // Leading zeros, other bases, floats and dates are left to a complete parser.
+  if (!is_after_digit || (length - first_digit > 1 && digits.at(first_digit) == '0') ||
+      (!is_at_end() && (is_bare_key(*m_current) || *m_current == '.' || *m_current == ':'))) {
+    return false;
+  }
+
+  const char* end{digits.data() + length};
+  const auto [pointer, error]{std::from_chars(digits.data(), end, number)};
+  return error == std::errc() && pointer == end;
+}
+
+void TomlReader::skip_whitespace() {
+  while (!is_at_end() && is_whitespace(*m_current)) {
+    ++m_current;
+  }
+}
+
+bool TomlReader::skip_comment() {
+  // Only tabs are allowed as control characters inside comments.
+  while (!is_at_end() && *m_current != '\n' && *m_current != '\r') {
+    if (is_control(*m_current)) {
+      return false;
+    }
+    ++m_current;
+  }
+
+  return true;
+}
+
+bool TomlReader::skip_blank() {
+  for (;;) {
+    skip_whitespace();
+
+    switch (peek()) {
+      case '#': {
+        if (!skip_comment()) {
+          return false;
+        }
+        break;
+      }
+      case '\r':
+      case '\n': {
+        if (!newline()) {
+          return false;
+        }
+        break;
+      }
+      default: {
+        return true;
+      }
+    }
+  }
+}
+
+bool TomlReader::end_of_line() {
+  skip_whitespace();
+
+  if (peek() == '#' && !skip_comment()) {
+    return false;
+  }
+
+  if (is_at_end()) {
+    return true;
+  }
+
+  return newline();
+}
+
+bool TomlReader::newline() {
+  if (peek() == '\r') {
+    ++m_current;
+  }
+
+  if (peek() != '\n') {
+    return false;
+  }
+
+  ++m_current;
+  ++m_line;
+  m_line_start = m_current;
+  m_line_end = nullptr;
+  return true;
+}
+
+char TomlReader::peek() const {
+  return is_at_end() ? '\0' : *m_current;
+}
+
+bool TomlReader::starts_with(std::string_view characters) const {
+  return static_cast<size_t>(m_end - m_current) >= characters.size() &&
+         std::memcmp(m_current, characters.data(), characters.size()) == 0;
+}
+
+bool TomlReader::is_at_end() const {
+  return m_current >= m_end;
+}
+
+Value::SourceLocation TomlReader::location() {
+  // The end of the current line is only searched once, by the first value asking for it.
+  if (m_line_end == nullptr) {
+    const auto* newline{static_cast<const char*>(
+        std::memchr(m_line_start, '\n', static_cast<size_t>(m_end - m_line_start)))};
+    m_line_end = newline == nullptr ? m_end : newline;
+    if (m_line_end > m_line_start && m_line_end[-1] == '\r') {
+      --m_line_end;
+    }
+  }
+
+  return {m_line,
+      static_cast<uint32_t>(m_current - m_line_start + 1),
+      {m_line_start, static_cast<size_t>(m_line_end - m_line_start)},
+      m_file_name};
+}
+
+bool TomlReader::is_bare_key(char character) {
+  return (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') ||
+         (character >= '0' && character <= '9') || character == '_' || character == '-';
+}
+
+bool TomlReader::is_control(char character) {
+  const auto code{static_cast<unsigned char>(character)};
+  return (code < 0x20 && character != '\t') || code == 0x7F;
+}
+
+}  // namespace Litr::Config
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+
+#include "Core/Config/Value.hpp"
+#include "Core/StringPool.hpp"
+
+namespace Litr::Config {
+
+// Reads the subset of TOML configurations are written in: tables, strings, arrays,
+// inline tables, booleans and decimal integers with bare or quoted keys. Values are views
+// into the source, only strings with escape sequences get unescaped into the string pool.
+// Anything else, e.g. floats, dates, dotted keys or arrays of tables, as well as invalid
+// TOML is rejected and left to a complete parser to handle and report.
+class TomlReader {
+ public:
+  // The file name is only used for the location of values and must outlive them.
+  TomlReader(std::string_view source, StringPool& strings, std::string_view file_name = {});
+
+  [[nodiscard]] bool read(Value& root);
+
+ private:
+  // A key is unique inside the table it is defined in, tables are known by id.
+  struct Key {
+    size_t table;
+    std::string_view name;
+
+    bool operator==(const Key& other) const {
+      return table == other.table && name == other.name;
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  struct Definition {
+    enum class Kind { IMPLICIT_TABLE, TABLE, VALUE };
+
+    size_t index;
+    size_t table;
+    Kind kind;
+  };
+
+  [[nodiscard]] bool table_header(Value& root, Value*& table, size_t& table_id);
+  [[nodiscard]] bool key_value(Value& table, size_t table_id);
+  [[nodiscard]] bool key(std::string_view& name);
+  [[nodiscard]] bool value(Value& value, size_t depth);
+
+  [[nodiscard]] bool basic_string(std::string_view& string);
+  [[nodiscard]] bool multi_line_basic_string(std::string_view& string);
+  [[nodiscard]] bool literal_string(std::string_view& string);
+  [[nodiscard]] bool multi_line_literal_string(std::string_view& string);
+  [[nodiscard]] bool unescape(std::string_view raw, bool multi_line, std::string_view& string);
+  [[nodiscard]] bool array(Value& array, size_t depth);
+  [[nodiscard]] bool inline_table(Value& table, size_t depth);
+  [[nodiscard]] bool keyword(std::string_view word);
+  [[nodiscard]] bool integer(int64_t& number);
+
+  void skip_whitespace();
+  [[nodiscard]] bool skip_comment();
+  [[nodiscard]] bool skip_blank();
+  [[nodiscard]] bool end_of_line();
+  [[nodiscard]] bool newline();
+
+  [[nodiscard]] char peek() const;
+  [[nodiscard]] bool starts_with(std::string_view characters) const;
+  [[nodiscard]] bool is_at_end() const;
+  [[nodiscard]] Value::SourceLocation location();
+
+  [[nodiscard]] static bool is_bare_key(char character);
+  [[nodiscard]] static bool is_control(char character);
+
+  static constexpr size_t max_depth{32};
+
+  const char* m_current;
+  const char* m_end;
+  const char* m_line_start;
+  const char* m_line_end{nullptr};
+  uint32_t m_line{1};
+  const std::string_view m_file_name;
+
+  StringPool& m_strings;
+  std::unordered_map<Key, Definition, KeyHash> m_keys{};
+  size_t m_table_count{0};
+};
+
+}  // namespace Litr::Config
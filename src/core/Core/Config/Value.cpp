@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Value.hpp"
+
+#include <stdexcept>
+
+#include "Core/Debug/Instrumentor.hpp"
+
+namespace Litr::Config {
+
+Value::Value(Type type, const SourceLocation& location) : m_type(type), m_location(location) {}
+
+Value::Value(std::string_view string, const SourceLocation& location)
+    : m_type(Type::STRING),
+      m_string(string),
+      m_location(location) {}
+
+Value::Value(int64_t integer, const SourceLocation& location)
+    : m_type(Type::INTEGER),
+      m_integer(integer),
+      m_location(location) {}
+
+std::string_view Value::as_string() const {
+  return m_string;
+}
+
+int64_t Value::as_integer() const {
+  return m_integer;
+}
+
+const Value::Array& Value::as_array() const {
+  return m_array;
+}
+
+const Value::Table& Value::as_table() const {
+  return m_table;
+}
+
+bool Value::contains(std::string_view key) const {
+  LITR_PROFILE_FUNCTION();
+
+  for (auto&& entry : m_table) {
+    if (entry.first == key) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+const Value& Value::at(std::string_view key) const {
+  LITR_PROFILE_FUNCTION();
+
+  for (auto&& entry : m_table) {
+    if (entry.first == key) {
+      return entry.second;
+    }
+  }
+
+  throw std::out_of_range{"Configuration key not found."};
+}
+
+}  // namespace Litr::Config
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Litr::Config {
+
+// A value of a configuration file. Strings, keys and source lines are views into the
+// parsed file, they stay valid as long as the root value returned by the parser exists.
+class Value {
+ public:
+  enum class Type { EMPTY, STRING, INTEGER, ARRAY, TABLE, OTHER };
+
+  using Array = std::vector<Value>;
+  // Entries keep the order they are written in.
+  using Table = std::vector<std::pair<std::string_view, Value>>;
+
+  // Provides the same accessors as a toml11 source location.
+  class SourceLocation {
+   public:
+    SourceLocation() = default;
+    SourceLocation(uint32_t line,
+        uint32_t column,
+        std::string_view line_str,
+        std::string_view file_name = {})
+        : m_line(line),
+          m_column(column),
+          m_line_str(line_str),
+          m_file_name(file_name) {}
+
+    [[nodiscard]] inline uint32_t line() const {
+      return m_line;
+    }
+    [[nodiscard]] inline uint32_t column() const {
+      return m_column;
+    }
+    [[nodiscard]] inline std::string line_str() const {
+      return std::string{m_line_str};
+    }
+    [[nodiscard]] inline std::string file_name() const {
+      return std::string{m_file_name};
+    }
+
+   private:
+    uint32_t m_line{0};
+    uint32_t m_column{0};
+    std::string_view m_line_str{};
+    std::string_view m_file_name{};
+  };
+
+  Value() = default;
+  Value(Type type, const SourceLocation& location);
+  Value(std::string_view string, const SourceLocation& location);
+  Value(int64_t integer, const SourceLocation& location);
+
+  [[nodiscard]] inline Type type() const {
+    return m_type;
+  }
+  [[nodiscard]] inline bool is_string() const {
+    return m_type == Type::STRING;
+  }
+  [[nodiscard]] inline bool is_integer() const {
+    return m_type == Type::INTEGER;
+  }
+  [[nodiscard]] inline bool is_array() const {
+    return m_type == Type::ARRAY;
+  }
+  [[nodiscard]] inline bool is_table() const {
+    return m_type == Type::TABLE;
+  }
+
+  // Accessing a value as a type it is not results in an empty value of that type.
+  [[nodiscard]] std::string_view as_string() const;
+  [[nodiscard]] int64_t as_integer() const;
+  [[nodiscard]] const Array& as_array() const;
+  [[nodiscard]] const Table& as_table() const;
+
+  [[nodiscard]] bool contains(std::string_view key) const;
+  // Throws `std::out_of_range` if the key does not exist, the same as toml11 does.
+  [[nodiscard]] const Value& at(std::string_view key) const;
+
+  [[nodiscard]] inline const SourceLocation& location() const {
+    return m_location;
+  }
+
+ private:
+  // Only parsers build up values.
+  friend class TomlReader;
+  friend class TomlFileAdapter;
+  friend class MappedFileAdapter;
+
+  Type m_type{Type::EMPTY};
+  std::string_view m_string{};
+  int64_t m_integer{0};
+  Array m_array{};
+  Table m_table{};
+  SourceLocation m_location{};
+
+  // Contents all views point into, only set on the root value of a parsed file.
+  std::shared_ptr<const void> m_storage{};
+};
+
+}  // namespace Litr::Config
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "AllocationTracker.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace Litr::Debug {
+
+std::array<AllocationTracker::Counters, AllocationTracker::phase_count>
+    AllocationTracker::s_counters{};
+std::atomic<size_t> AllocationTracker::s_live_bytes{0};
+std::atomic<size_t> AllocationTracker::s_peak_live_bytes{0};
+
+thread_local std::array<AllocationTracker::Phase, AllocationTracker::max_phase_depth>
+    AllocationTracker::s_phases{};
+thread_local size_t AllocationTracker::s_phase_depth{0};
+
+void AllocationTracker::push_phase(Phase phase) {
+  // Deeper nesting is still counted, but to the deepest phase that could be stored.
+  if (s_phase_depth < max_phase_depth) {
+    s_phases.at(s_phase_depth) = phase;
+  }
+  ++s_phase_depth;
+}
+
+void AllocationTracker::pop_phase() {
+  if (s_phase_depth > 0) {
+    --s_phase_depth;
+  }
+}
+
+AllocationTracker::Phase AllocationTracker::record_allocation(size_t size) {
+  Phase phase{Phase::OTHER};
+  if (s_phase_depth > 0) {
+    phase = s_phases.at(std::min(s_phase_depth, max_phase_depth) - 1);
+  }
+
+  Counters& counters{s_counters.at(static_cast<size_t>(phase))};
+  counters.allocations.fetch_add(1, std::memory_order_relaxed);
+  counters.allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+  const size_t live_bytes{counters.live_bytes.fetch_add(size, std::memory_order_relaxed) + size};
+  update_peak(counters.peak_live_bytes, live_bytes);
+  update_peak(s_peak_live_bytes, s_live_bytes.fetch_add(size, std::memory_order_relaxed) + size);
+
+  return phase;
+}
+
+void AllocationTracker::record_deallocation(size_t size, Phase phase) {
+  // Memory is freed from the phase that allocated it, this way live bytes per phase stay accurate.
+  Counters& counters{s_counters.at(static_cast<size_t>(phase))};
+  counters.deallocations.fetch_add(1, std::memory_order_relaxed);
+  counters.live_bytes.fetch_sub(size, std::memory_order_relaxed);
+  s_live_bytes.fetch_sub(size, std::memory_order_relaxed);
+}
+
+AllocationTracker::Statistics AllocationTracker::get_statistics(Phase phase) {
+  const Counters& counters{s_counters.at(static_cast<size_t>(phase))};
+  return {counters.allocations.load(std::memory_order_relaxed),
+      counters.deallocations.load(std::memory_order_relaxed),
+      counters.allocated_bytes.load(std::memory_order_relaxed),
+      counters.live_bytes.load(std::memory_order_relaxed),
+      counters.peak_live_bytes.load(std::memory_order_relaxed)};
+}
+
+size_t AllocationTracker::get_peak_live_bytes() {
+  return s_peak_live_bytes.load(std::memory_order_relaxed);
+}
+
+void AllocationTracker::reset() {
+  for (auto&& counters : s_counters) {
+    counters.allocations = 0;
+    counters.deallocations = 0;
+    counters.allocated_bytes = 0;
+    counters.live_bytes = 0;
+    counters.peak_live_bytes = 0;
+  }
+  s_live_bytes = 0;
+  s_peak_live_bytes = 0;
+}
+
+void AllocationTracker::print_summary() {
+  // Take all numbers first, printing allocates itself.
+  std::array<Statistics, phase_count> statistics{};
+  for (size_t phase{0}; phase < phase_count; ++phase) {
+    statistics.at(phase) = get_statistics(static_cast<Phase>(phase));
+  }
+  const size_t peak_live_bytes{get_peak_live_bytes()};
+
+  fmt::print(stderr,
+      "\n{:<16} {:>12} {:>12} {:>16} {:>16} {:>16}\n",
+      "Phase",
+      "Allocations",
+      "Frees",
+      "Allocated bytes",
+      "Peak live bytes",
+      "Live at exit");
+
+  for (size_t phase{0}; phase < phase_count; ++phase) {
+    const Statistics& phase_statistics{statistics.at(phase)};
+    fmt::print(stderr,
+        "{:<16} {:>12} {:>12} {:>16} {:>16} {:>16}\n",
+        get_phase_name(static_cast<Phase>(phase)),
+        phase_statistics.allocations,
+        phase_statistics.deallocations,
+        phase_statistics.allocated_bytes,
+        phase_statistics.peak_live_bytes,
+        phase_statistics.live_bytes);
+  }
+
+  fmt::print(stderr, "Peak live bytes overall: {}\n", peak_live_bytes);
+}
+
+const char* AllocationTracker::get_phase_name(Phase phase) {
+  switch (phase) {
+    case Phase::OTHER:
+      return "other";
+    case Phase::CLI_PARSE:
+      return "cli parse";
+    case Phase::CONFIG_RESOLVE:
+      return "config resolve";
+    case Phase::TOML_PARSE:
+      return "toml parse";
+    case Phase::LOADER_BUILD:
+      return "loader build";
+    case Phase::QUERY:
+      return "query";
+    case Phase::SCRIPT_COMPILE:
+      return "script compile";
+    case Phase::EXECUTION:
+      return "execution";
+    case Phase::COUNT:
+      break;
+  }
+
+  return "unknown";
+}
+
+void AllocationTracker::update_peak(std::atomic<size_t>& peak, size_t value) {
+  size_t current{peak.load(std::memory_order_relaxed)};
+  while (value > current &&
+         !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
+}
+
+}  // namespace Litr::Debug
+
+#if LITR_TRACK_ALLOCATIONS
+// Replacing the global allocation functions needs them to live in a translation unit that is
+// linked for sure, this is why they are part of the tracker itself. Every allocation gets a
+// header storing its size and phase, so frees are accounted correctly without sized deletes.
+// Over-aligned allocations use their own default functions and are not tracked.
+
+/** @private */
+struct alignas(std::max_align_t) AllocationHeader {
+  size_t size;
+  Litr::Debug::AllocationTracker::Phase phase;
+};
+
+/** @private */
+static void* tracked_allocate(size_t size) noexcept {
+  // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+  auto* header{static_cast<AllocationHeader*>(std::malloc(sizeof(AllocationHeader) + size))};
+  if (header == nullptr) {
+    return nullptr;
+  }
+
+  header->size = size;
+  header->phase = Litr::Debug::AllocationTracker::record_allocation(size);
+  return header + 1;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+/** @private */
+static void tracked_free(void* memory) noexcept {
+  if (memory == nullptr) {
+    return;
+  }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  AllocationHeader* header{static_cast<AllocationHeader*>(memory) - 1};
+  Litr::Debug::AllocationTracker::record_deallocation(header->size, header->phase);
+  std::free(header);  // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+void* operator new(size_t size) {
+  void* memory{tracked_allocate(size)};
+  if (memory == nullptr) {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+void* operator new[](size_t size) {
+  void* memory{tracked_allocate(size)};
+  if (memory == nullptr) {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+void* operator new(size_t size, const std::nothrow_t& /*tag*/) noexcept {
+  return tracked_allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t& /*tag*/) noexcept {
+  return tracked_allocate(size);
+}
+
+void operator delete(void* memory) noexcept {
+  tracked_free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+  tracked_free(memory);
+}
+
+void operator delete(void* memory, size_t /*size*/) noexcept {
+  tracked_free(memory);
+}
+
+void operator delete[](void* memory, size_t /*size*/) noexcept {
+  tracked_free(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t& /*tag*/) noexcept {
+  tracked_free(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t& /*tag*/) noexcept {
+  tracked_free(memory);
+}
+#endif
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace Litr::Debug {
+
+// Counts heap allocations per phase of the application. With `LITR_TRACK_ALLOCATIONS`
+// defined the global `operator new` and `operator delete` are replaced to feed it.
+// Allocations are always accounted to the innermost active phase of the current thread.
+class AllocationTracker {
+ public:
+  enum class Phase {
+    OTHER,
+    CLI_PARSE,
+    CONFIG_RESOLVE,
+    TOML_PARSE,
+    LOADER_BUILD,
+    QUERY,
+    SCRIPT_COMPILE,
+    EXECUTION,
+    COUNT
+  };
+
+  struct Statistics {
+    size_t allocations{0};
+    size_t deallocations{0};
+    size_t allocated_bytes{0};
+    size_t live_bytes{0};
+    size_t peak_live_bytes{0};
+  };
+
+  AllocationTracker() = delete;
+
+  static void push_phase(Phase phase);
+  static void pop_phase();
+
+  [[nodiscard]] static Phase record_allocation(size_t size);
+  static void record_deallocation(size_t size, Phase phase);
+
+  [[nodiscard]] static Statistics get_statistics(Phase phase);
+  [[nodiscard]] static size_t get_peak_live_bytes();
+  static void reset();
+
+  static void print_summary();
+
+ private:
+  struct Counters {
+    std::atomic<size_t> allocations{0};
+    std::atomic<size_t> deallocations{0};
+    std::atomic<size_t> allocated_bytes{0};
+    std::atomic<size_t> live_bytes{0};
+    std::atomic<size_t> peak_live_bytes{0};
+  };
+
+  static constexpr size_t max_phase_depth{32};
+  static constexpr size_t phase_count{static_cast<size_t>(Phase::COUNT)};
+
+  [[nodiscard]] static const char* get_phase_name(Phase phase);
+  static void update_peak(std::atomic<size_t>& peak, size_t value);
+
+  static std::array<Counters, phase_count> s_counters;
+  static std::atomic<size_t> s_live_bytes;
+  static std::atomic<size_t> s_peak_live_bytes;
+
+  // Phases of the current thread, it must not allocate as it is used inside `operator new`.
+  static thread_local std::array<Phase, max_phase_depth> s_phases;
+  static thread_local size_t s_phase_depth;
+};
+
+// Marks a phase until the end of the current scope.
+class AllocationPhase {
+ public:
+  explicit AllocationPhase(AllocationTracker::Phase phase) {
+    AllocationTracker::push_phase(phase);
+  }
+
+  AllocationPhase(const AllocationPhase&) = delete;
+  AllocationPhase(AllocationPhase&&) = delete;
+  AllocationPhase& operator=(const AllocationPhase&) = delete;
+  AllocationPhase& operator=(AllocationPhase&&) = delete;
+
+  ~AllocationPhase() {
+    AllocationTracker::pop_phase();
+  }
+};
+
+}  // namespace Litr::Debug
+
+#if LITR_TRACK_ALLOCATIONS
+#define LITR_ALLOCATION_JOIN_AGAIN(x, y) x##y
+#define LITR_ALLOCATION_JOIN(x, y) LITR_ALLOCATION_JOIN_AGAIN(x, y)
+#define LITR_ALLOCATION_PHASE(phase)                                                \
+  ::Litr::Debug::AllocationPhase LITR_ALLOCATION_JOIN(allocation_phase, __LINE__) { \
+    ::Litr::Debug::AllocationTracker::Phase::phase                                  \
+  }
+#define LITR_ALLOCATION_SUMMARY() ::Litr::Debug::AllocationTracker::print_summary()
+#else
+#define LITR_ALLOCATION_PHASE(phase)
+#define LITR_ALLOCATION_SUMMARY()
+#endif
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <chrono>
+
+namespace Litr::Debug {
+
+// CPU time spent by all child processes that terminated and have been waited for.
+struct CpuTime {
+  std::chrono::microseconds user{0};
+  std::chrono::microseconds system{0};
+
+  [[nodiscard]] static CpuTime of_children();
+
+  CpuTime operator-(const CpuTime& other) const {
+    return {user - other.user, system - other.system};
+  }
+};
+
+}  // namespace Litr::Debug
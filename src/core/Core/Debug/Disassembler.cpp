@@ -17,19 +17,19 @@ static size_t simple_instruction(const std::string& name, const size_t offset) {
 /** @private */
 static size_t constant_instruction(const std::string& name,
     const std::shared_ptr<CLI::Instruction>& instruction,
-    const size_t offset) {
-  const std::byte index{instruction->read(offset)};
+    size_t offset) {
+  const size_t index{instruction->read_operand(offset)};
   const CLI::Instruction::Value constant{instruction->read_constant(index)};
 
   fmt::print("{:<16} {:4d} '{}'\n", name, index, constant);
-  return offset + 1;
+  return offset;
 }
 
 size_t disassemble_instruction(
     const std::shared_ptr<CLI::Instruction>& instruction, size_t offset) {
   fmt::print("{:04d} ", offset);
 
-  const CLI::Instruction::Code code{instruction->read(offset++)};
+  const auto code{static_cast<CLI::Instruction::Code>(instruction->read(offset++))};
 
   switch (code) {
     case CLI::Instruction::Code::CONSTANT:
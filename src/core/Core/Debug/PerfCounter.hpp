@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Litr::Debug {
+
+// Counts what a spawned task (and every process it forks) costs, based on the
+// platform performance counters. Hardware counters are optional, if the system
+// (e.g. a container) does not allow them only software counters are reported.
+class PerfCounter {
+ public:
+  struct Value {
+    enum class Unit { COUNT, NANOSECONDS };
+
+    std::string name;
+    uint64_t count{0};
+    Unit unit{Unit::COUNT};
+  };
+
+  using Values = std::vector<Value>;
+
+  PerfCounter() = default;
+  PerfCounter(const PerfCounter&) = delete;
+  PerfCounter(PerfCounter&&) = delete;
+  PerfCounter& operator=(const PerfCounter&) = delete;
+  PerfCounter& operator=(PerfCounter&&) = delete;
+  ~PerfCounter();
+
+  void start();
+  void stop();
+
+  [[nodiscard]] Values get_values() const;
+
+ private:
+  struct Event {
+    std::string name;
+    int file_descriptor;
+    Value::Unit unit;
+  };
+
+  void close_events();
+
+  std::vector<Event> m_events{};
+};
+
+}  // namespace Litr::Debug
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "DirectoryWalker.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <system_error>
+#include <utility>
+
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/MappedFile.hpp"
+#include "Core/ThreadPool.hpp"
+
+namespace Litr {
+
+DirectoryWalker::DirectoryWalker(Path root) : m_root(std::move(root)) {}
+
+void DirectoryWalker::set_directory_filter(const Filter& filter) {
+  LITR_PROFILE_FUNCTION();
+
+  m_directory_filter = filter;
+}
+
+void DirectoryWalker::set_max_depth(size_t depth) {
+  LITR_PROFILE_FUNCTION();
+
+  m_max_depth = depth;
+}
+
+void DirectoryWalker::set_respect_git_ignore(bool respect) {
+  LITR_PROFILE_FUNCTION();
+
+  m_respect_git_ignore = respect;
+}
+
+std::vector<DirectoryWalker::Entry> DirectoryWalker::walk(const Filter& filter) const {
+  LITR_PROFILE_FUNCTION();
+
+  std::vector<Entry> entries{};
+  std::vector<Directory> level{{m_root.to_string(), "", std::make_shared<GitIgnore>()}};
+  ThreadPool pool{};
+
+  for (size_t depth{0}; depth < m_max_depth && !level.empty(); ++depth) {
+    // Every directory collects on its own, so no thread has to wait for another.
+    std::vector<std::vector<Entry>> found(level.size());
+    std::vector<std::vector<Directory>> next(level.size());
+
+    pool.run(level.size(), [&](size_t index) {
+      read_directory(level[index], filter, found[index], next[index]);
+    });
+
+    level.clear();
+    for (size_t index{0}; index < found.size(); ++index) {
+      std::move(found[index].begin(), found[index].end(), std::back_inserter(entries));
+      std::move(next[index].begin(), next[index].end(), std::back_inserter(level));
+    }
+  }
+
+  std::sort(entries.begin(), entries.end(), [](const Entry& left, const Entry& right) {
+    return left.relative_path < right.relative_path;
+  });
+
+  return entries;
+}
+
+void DirectoryWalker::read_directory(const Directory& directory,
+    const Filter& filter,
+    std::vector<Entry>& entries,
+    std::vector<Directory>& directories) const {
+  LITR_PROFILE_FUNCTION();
+
+  const std::shared_ptr<const GitIgnore> ignore{read_git_ignore(directory)};
+  std::error_code error{};
+
+  for (auto&& item : std::filesystem::directory_iterator{
+           directory.path, std::filesystem::directory_options::skip_permission_denied, error}) {
+    const std::string name{item.path().filename().string()};
+    if (name == ".git") {
+      continue;
+    }
+
+    // The type is mostly known from reading the directory already, it needs no extra call.
+    const bool is_link{item.is_symlink(error)};
+    Entry entry{Path{item.path().string()},
+        directory.relative_path.empty() ? name : directory.relative_path + '/' + name,
+        item.is_directory(error)};
+
+    if (ignore->is_ignored(entry.relative_path, entry.is_directory)) {
+      continue;
+    }
+
+    if (entry.is_directory && !is_link && (!m_directory_filter || m_directory_filter(entry))) {
+      directories.push_back({item.path(), entry.relative_path, ignore});
+    }
+
+    if (filter(entry)) {
+      entries.push_back(std::move(entry));
+    }
+  }
+}
+
+std::shared_ptr<const GitIgnore> DirectoryWalker::read_git_ignore(
+    const Directory& directory) const {
+  LITR_PROFILE_FUNCTION();
+
+  if (!m_respect_git_ignore) {
+    return directory.ignore;
+  }
+
+  const MappedFile file{Path{(directory.path / ".gitignore").string()}};
+  if (!file.is_open()) {
+    return directory.ignore;
+  }
+
+  // Only directories with a file of their own need a copy of the rules.
+  auto ignore{std::make_shared<GitIgnore>(*directory.ignore)};
+  ignore->add_rules(directory.relative_path, file.get_contents());
+  return ignore;
+}
+
+}  // namespace Litr
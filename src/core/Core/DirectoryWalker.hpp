@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Core/FileSystem.hpp"
+#include "Core/GitIgnore.hpp"
+
+namespace Litr {
+
+// Walks a directory tree level by level, where all directories of a level are read in
+// parallel. The `.git` directory is never walked, symbolic links to directories are
+// listed but not followed.
+class DirectoryWalker {
+ public:
+  struct Entry {
+    Path path{};
+    // Slash separated path relative to the walked directory.
+    std::string relative_path{};
+    bool is_directory{false};
+  };
+
+  // Filters are called from multiple threads at the same time.
+  using Filter = std::function<bool(const Entry& entry)>;
+
+  explicit DirectoryWalker(Path root);
+
+  // Directories the filter rejects are not walked into, which saves reading them at all.
+  void set_directory_filter(const Filter& filter);
+  void set_max_depth(size_t depth);
+  void set_respect_git_ignore(bool respect);
+
+  // Finds all entries accepted by the filter, sorted by their relative path.
+  [[nodiscard]] std::vector<Entry> walk(const Filter& filter) const;
+
+ private:
+  struct Directory {
+    std::filesystem::path path{};
+    std::string relative_path{};
+    std::shared_ptr<const GitIgnore> ignore{};
+  };
+
+  void read_directory(const Directory& directory,
+      const Filter& filter,
+      std::vector<Entry>& entries,
+      std::vector<Directory>& directories) const;
+  [[nodiscard]] std::shared_ptr<const GitIgnore> read_git_ignore(
+      const Directory& directory) const;
+
+  const Path m_root;
+  Filter m_directory_filter{};
+  size_t m_max_depth{std::numeric_limits<size_t>::max()};
+  bool m_respect_git_ignore{false};
+};
+
+}  // namespace Litr
@@ -11,6 +11,8 @@ namespace Litr {
 class Environment {
  public:
   [[nodiscard]] static Path get_home_directory();
+  // Directory for files Litr keeps between runs, it might not exist yet.
+  [[nodiscard]] static Path get_cache_directory();
 };
 
 }  // namespace Litr
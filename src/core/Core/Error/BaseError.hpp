@@ -9,6 +9,7 @@
 
 #include "Core/Config/Location.hpp"
 #include "Core/Config/TomlFileAdapter.hpp"
+#include "Core/Config/Value.hpp"
 #include "Core/Debug/Instrumentor.hpp"
 #include "Core/Error/TomlError.hpp"
 
@@ -31,7 +32,8 @@ class BaseError {
     CLI_PARSER,                // Error while parsing CLI input arguments
     SCRIPT_PARSER,             // Error while parsing scripts
     COMMAND_NOT_FOUND,         // On execution, command not found
-    EXECUTION_FAILURE          // Issue executing a command
+    EXECUTION_FAILURE,         // Issue executing a command
+    TIMEOUT                    // Command ran longer than its timeout
   };
 
   BaseError(const ErrorType type, std::string message) : type(type), message(std::move(message)) {
@@ -49,12 +51,20 @@ class BaseError {
     LITR_PROFILE_FUNCTION();
   }
 
-  BaseError(
-      const ErrorType type, std::string message, const Config::TomlFileAdapter::Value& context)
+  BaseError(const ErrorType type, std::string message, Config::Location location)
       : type(type),
         message(std::move(message)),
-        location(
-            context.location().line(), context.location().column(), context.location().line_str()) {
+        location(std::move(location)) {
+    LITR_PROFILE_FUNCTION();
+  }
+
+  BaseError(const ErrorType type, std::string message, const Config::Value& context)
+      : type(type),
+        message(std::move(message)),
+        location(context.location().line(),
+            context.location().column(),
+            context.location().line_str(),
+            context.location().file_name()) {
     LITR_PROFILE_FUNCTION();
   }
 
@@ -62,7 +72,10 @@ class BaseError {
       const ErrorType type, std::string message, const Config::TomlFileAdapter::Exception& err)
       : type(type),
         message(std::move(message)),
-        location(err.location().line(), err.location().column(), err.location().line_str()) {
+        location(err.location().line(),
+            err.location().column(),
+            err.location().line_str(),
+            err.location().file_name()) {
     LITR_PROFILE_FUNCTION();
   }
 
@@ -78,7 +91,7 @@ class BaseError {
 
 class ReservedParamError : public BaseError {
  public:
-  ReservedParamError(const std::string& message, const Config::TomlFileAdapter::Value& context)
+  ReservedParamError(const std::string& message, const Config::Value& context)
       : BaseError(ErrorType::RESERVED_PARAM, message, context) {
     BaseError::description = "Parameter name is reserved!";
   }
@@ -88,6 +101,10 @@ class MalformedFileError : public BaseError {
  public:
   explicit MalformedFileError(const std::string& message)
       : BaseError(ErrorType::MALFORMED_FILE, message) {}
+  MalformedFileError(const std::string& message, const Config::Value& context)
+      : BaseError(ErrorType::MALFORMED_FILE, message, context) {
+    BaseError::description = "Invalid file format!";
+  }
   MalformedFileError(const std::string& message, const Config::TomlFileAdapter::Exception& err)
       : BaseError(ErrorType::MALFORMED_FILE, TomlError::extract_message(message, err.what()), err) {
     BaseError::description = "Invalid file format!";
@@ -96,7 +113,7 @@ class MalformedFileError : public BaseError {
 
 class MalformedCommandError : public BaseError {
  public:
-  MalformedCommandError(const std::string& message, const Config::TomlFileAdapter::Value& context)
+  MalformedCommandError(const std::string& message, const Config::Value& context)
       : BaseError(ErrorType::MALFORMED_COMMAND, message, context) {
     BaseError::description = "Command format is wrong!";
   }
@@ -104,7 +121,7 @@ class MalformedCommandError : public BaseError {
 
 class MalformedParamError : public BaseError {
  public:
-  MalformedParamError(const std::string& message, const Config::TomlFileAdapter::Value& context)
+  MalformedParamError(const std::string& message, const Config::Value& context)
       : BaseError(ErrorType::MALFORMED_PARAM, message, context) {
     BaseError::description = "Parameter format is wrong!";
   }
@@ -112,7 +129,7 @@ class MalformedParamError : public BaseError {
 
 class MalformedScriptError : public BaseError {
  public:
-  MalformedScriptError(const std::string& message, const Config::TomlFileAdapter::Value& context)
+  MalformedScriptError(const std::string& message, const Config::Value& context)
       : BaseError(ErrorType::MALFORMED_SCRIPT, message, context) {
     BaseError::description = "Command script is wrong!";
   }
@@ -120,8 +137,7 @@ class MalformedScriptError : public BaseError {
 
 class UnknownCommandPropertyError : public BaseError {
  public:
-  UnknownCommandPropertyError(
-      const std::string& message, const Config::TomlFileAdapter::Value& context)
+  UnknownCommandPropertyError(const std::string& message, const Config::Value& context)
       : BaseError(ErrorType::UNKNOWN_COMMAND_PROPERTY, message, context) {
     BaseError::description = "Command property does not exist!";
   }
@@ -129,7 +145,7 @@ class UnknownCommandPropertyError : public BaseError {
 
 class UnknownParamValueError : public BaseError {
  public:
-  UnknownParamValueError(const std::string& message, const Config::TomlFileAdapter::Value& context)
+  UnknownParamValueError(const std::string& message, const Config::Value& context)
       : BaseError(ErrorType::UNKNOWN_PARAM_VALUE, message, context) {
     BaseError::description = "Parameter value is not known!";
   }
@@ -137,7 +153,7 @@ class UnknownParamValueError : public BaseError {
 
 class ValueAlreadyInUseError : public BaseError {
  public:
-  ValueAlreadyInUseError(const std::string& message, const Config::TomlFileAdapter::Value& context)
+  ValueAlreadyInUseError(const std::string& message, const Config::Value& context)
       : BaseError(ErrorType::VALUE_ALREADY_IN_USE, message, context) {
     BaseError::description = "Value is is already in use!";
   }
@@ -154,9 +170,8 @@ class CLIParserError : public BaseError {
 
 class ScriptParserError : public BaseError {
  public:
-  ScriptParserError(
-      const std::string& message, uint32_t line, uint32_t column, const std::string& lineStr)
-      : BaseError(ErrorType::CLI_PARSER, message, line, column, lineStr) {
+  ScriptParserError(const std::string& message, const Config::Location& location)
+      : BaseError(ErrorType::CLI_PARSER, message, location) {
     BaseError::description = "Problem parsing script!";
   }
 };
@@ -177,4 +192,11 @@ class ExecutionFailureError : public BaseError {
   }
 };
 
+class TimeoutError : public BaseError {
+ public:
+  explicit TimeoutError(const std::string& message) : BaseError(ErrorType::TIMEOUT, message) {
+    BaseError::description = "Command timed out!";
+  }
+};
+
 }  // namespace Litr::Error
@@ -31,8 +31,9 @@ class Handler {
  private:
   Handler() = default;
 
+  // Every thread collects its own errors, tasks running in parallel do not mix them up.
   static Handler& get() {
-    static Handler instance{};
+    static thread_local Handler instance{};
     return instance;
   }
 
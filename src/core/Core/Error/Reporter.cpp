@@ -41,14 +41,20 @@ void Reporter::print_error(const BaseError& error) {
     case BaseError::ErrorType::UNKNOWN_PARAM_VALUE:
     case BaseError::ErrorType::CLI_PARSER:
     case BaseError::ErrorType::SCRIPT_PARSER: {
-      if (m_multiple_errors) {
-        fmt::print(fg(fmt::color::crimson), " ...\n");
-      } else {
+      const Path file_path{get_file_path(error)};
+
+      if (!m_multiple_errors) {
         // Title
         fmt::print(fg(fmt::color::crimson), "Error: {}\n", error.description);
         // File
-        fmt::print(fg(fmt::color::dark_gray), "  → {}\n", m_file_path);
+        fmt::print(fg(fmt::color::dark_gray), "  → {}\n", file_path);
+      } else if (file_path != m_last_file_path) {
+        // Errors of included files change the file in between.
+        fmt::print(fg(fmt::color::dark_gray), "  → {}\n", file_path);
+      } else {
+        fmt::print(fg(fmt::color::crimson), " ...\n");
       }
+      m_last_file_path = file_path;
 
       // Line view
       fmt::print(
@@ -68,7 +74,8 @@ void Reporter::print_error(const BaseError& error) {
       fmt::print(fg(fmt::color::crimson), "Error: {}\n", error.message);
       break;
     }
-    case BaseError::ErrorType::EXECUTION_FAILURE: {
+    case BaseError::ErrorType::EXECUTION_FAILURE:
+    case BaseError::ErrorType::TIMEOUT: {
       // Message
       fmt::print(fg(fmt::color::crimson), "Error: {}\n", error.message);
       // File
@@ -80,6 +87,12 @@ void Reporter::print_error(const BaseError& error) {
   m_multiple_errors = true;
 }
 
+Path Reporter::get_file_path(const BaseError& error) const {
+  LITR_PROFILE_FUNCTION();
+
+  return error.location.file.empty() ? m_file_path : Path{error.location.file};
+}
+
 uint32_t Reporter::count_digits(uint32_t number) {
   LITR_PROFILE_FUNCTION();
 
@@ -19,9 +19,12 @@ class Reporter {
   void print_error(const BaseError& error);
 
  private:
+  [[nodiscard]] Path get_file_path(const BaseError& error) const;
   static uint32_t count_digits(uint32_t number);
 
+  // Errors point into this file, unless their location names a different one.
   const Path m_file_path;
+  Path m_last_file_path{};
   bool m_multiple_errors{false};
 };
 
@@ -63,7 +63,7 @@ std::string TomlError::extract_duplicated_value_error(const std::string& error)
     output.append(lines[i]).append("\n");
   }
 
-  return Utils::trim(output, '\n');
+  return std::string{Utils::trim(output, '\n')};
 }
 
 bool TomlError::is_duplicated_table_error(const std::string& error) {
@@ -99,7 +99,7 @@ std::string TomlError::extract_duplicated_table_error(const std::string& error)
     output.append(lines[i]).append("\n");
   }
 
-  return Utils::trim(output, '\n');
+  return std::string{Utils::trim(output, '\n')};
 }
 
 bool TomlError::is_file_reference(const std::string& line) {
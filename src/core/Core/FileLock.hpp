@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include "Core/FileSystem.hpp"
+
+namespace Litr {
+
+// An advisory lock on a file, shared by every process agreeing to use it. The file is
+// created if it does not exist, the lock is released at the latest with this instance or
+// the process ending.
+class FileLock {
+ public:
+  explicit FileLock(const Path& path);
+
+  // Neither copy nor move, the lock belongs to this instance only.
+  FileLock(const FileLock&) = delete;
+  FileLock(FileLock&&) = delete;
+  FileLock& operator=(const FileLock&) = delete;
+  FileLock& operator=(FileLock&&) = delete;
+  ~FileLock();
+
+  [[nodiscard]] inline bool is_open() const {
+    return m_file_descriptor != -1;
+  }
+
+  // Takes the lock only if nobody else holds it.
+  [[nodiscard]] bool try_lock();
+  // Waits for as long as somebody else holds the lock.
+  bool lock();
+  void unlock();
+
+ private:
+  int m_file_descriptor{-1};
+};
+
+}  // namespace Litr
@@ -4,9 +4,17 @@
 
 #include "FileSystem.hpp"
 
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <system_error>
 #include <utility>
 
 #include "Core/Debug/Instrumentor.hpp"
+#include "Core/DirectoryWalker.hpp"
+#include "Core/Utils.hpp"
 
 namespace Litr {
 
@@ -51,6 +59,10 @@ Path Path::without_filename() const {
   return Path(path.remove_filename());
 }
 
+std::string Path::filename() const {
+  return m_path.filename().string();
+}
+
 size_t Path::count() const {
   // @todo: This could probably use std::distance
   size_t count{0};
@@ -74,4 +86,110 @@ Path FileSystem::get_current_working_directory() {
   return Path(std::filesystem::current_path());
 }
 
+Path FileSystem::get_absolute_path(const Path& path) {
+  LITR_PROFILE_FUNCTION();
+
+  // Not using `std::filesystem::absolute`, it fails on an empty path.
+  std::error_code error{};
+  std::filesystem::path absolute{std::filesystem::current_path(error)};
+  if (error) {
+    return Path(path.m_path.lexically_normal().string());
+  }
+
+  // Appending an absolute path replaces the current directory.
+  absolute /= path.m_path;
+  return Path(absolute.lexically_normal().string());
+}
+
+std::vector<Path> FileSystem::glob(const Path& directory, const std::string& pattern) {
+  LITR_PROFILE_FUNCTION();
+
+  return find_matches(directory.append(pattern).to_string(), false, false);
+}
+
+std::vector<Path> FileSystem::glob_directories(
+    const std::string& pattern, bool respect_git_ignore) {
+  LITR_PROFILE_FUNCTION();
+
+  return find_matches(pattern, true, respect_git_ignore);
+}
+
+bool FileSystem::has_wildcards(std::string_view pattern) {
+  return pattern.find_first_of("*?") != std::string_view::npos;
+}
+
+bool FileSystem::write_file(const Path& path, std::string_view contents) {
+  LITR_PROFILE_FUNCTION();
+
+  // Written to a file of its own first, renaming it over the old one is atomic.
+  const std::string temporary_path{
+      fmt::format("{}.{:x}.tmp", path.to_string(), std::random_device{}())};
+
+  {
+    std::ofstream file{temporary_path, std::ios::binary | std::ios::trunc};
+    file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    if (!file) {
+      return false;
+    }
+  }
+
+  std::error_code error{};
+  std::filesystem::rename(temporary_path, path.to_string(), error);
+  if (error) {
+    std::filesystem::remove(temporary_path, error);
+    return false;
+  }
+
+  return true;
+}
+
+std::vector<Path> FileSystem::find_matches(
+    const std::string& pattern, bool directories, bool respect_git_ignore) {
+  LITR_PROFILE_FUNCTION();
+
+  const std::string path{Utils::trim_right(pattern, '/')};
+  std::error_code error{};
+
+  if (!has_wildcards(path)) {
+    const bool exists{directories ? std::filesystem::is_directory(path, error)
+                                  : std::filesystem::is_regular_file(path, error)};
+    return exists ? std::vector<Path>{Path(path)} : std::vector<Path>{};
+  }
+
+  // Everything before the first wildcard is a plain directory to start walking from.
+  const size_t separator{path.rfind('/', path.find_first_of("*?"))};
+  const std::string base{separator == std::string::npos ? "" : path.substr(0, separator + 1)};
+  const std::string rest{separator == std::string::npos ? path : path.substr(separator + 1)};
+
+  DirectoryWalker walker{Path(base.empty() ? "." : base)};
+  walker.set_respect_git_ignore(respect_git_ignore);
+  if (rest.find("**") == std::string::npos) {
+    walker.set_max_depth(static_cast<size_t>(std::count(rest.begin(), rest.end(), '/')) + 1);
+  }
+  walker.set_directory_filter([&rest](const DirectoryWalker::Entry& entry) {
+    return Utils::matches_glob_start(entry.relative_path, rest, false);
+  });
+
+  const std::vector<DirectoryWalker::Entry> entries{
+      walker.walk([&rest, directories](const DirectoryWalker::Entry& entry) {
+        return entry.is_directory == directories &&
+               Utils::matches_glob(entry.relative_path, rest, false);
+      })};
+
+  std::vector<Path> matches{};
+  matches.reserve(entries.size() + 1);
+
+  // A double star matches no directory at all as well, leaving the one walked.
+  if (directories && Utils::matches_glob("", rest, false) &&
+      std::filesystem::is_directory(base.empty() ? "." : base, error)) {
+    matches.emplace_back(base.empty() ? "." : base);
+  }
+
+  for (auto&& entry : entries) {
+    matches.emplace_back(base + entry.relative_path);
+  }
+
+  return matches;
+}
+
 }  // namespace Litr
@@ -9,6 +9,8 @@
 
 #include <filesystem>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace Litr {
 
@@ -29,6 +31,7 @@ class Path {
   [[nodiscard]] Path append(const Path& path) const;
 
   [[nodiscard]] Path without_filename() const;
+  [[nodiscard]] std::string filename() const;
 
   [[nodiscard]] size_t count() const;
 
@@ -76,6 +79,25 @@ class FileSystem {
  public:
   [[nodiscard]] static bool exists(const Path& path);
   [[nodiscard]] static Path get_current_working_directory();
+  // Relative paths are resolved against the current directory, an empty path is the current
+  // directory itself. The result is normalized.
+  [[nodiscard]] static Path get_absolute_path(const Path& path);
+
+  // Finds all files matching a pattern relative to the directory. Every part of the pattern
+  // can contain wildcards as of `Utils::matches_glob`. Hidden entries only match parts
+  // that start with a dot themselves. Found files are sorted.
+  [[nodiscard]] static std::vector<Path> glob(const Path& directory, const std::string& pattern);
+  // Same as `glob`, but finds directories. If asked to, whatever a `.gitignore` file inside
+  // the walked directories excludes is skipped.
+  [[nodiscard]] static std::vector<Path> glob_directories(
+      const std::string& pattern, bool respect_git_ignore);
+  [[nodiscard]] static bool has_wildcards(std::string_view pattern);
+  // Replaces the file as a whole, nobody reading it at the same time ever sees half of it.
+  static bool write_file(const Path& path, std::string_view contents);
+
+ private:
+  [[nodiscard]] static std::vector<Path> find_matches(
+      const std::string& pattern, bool directories, bool respect_git_ignore);
 };
 
 }  // namespace Litr
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <chrono>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Core/FileSystem.hpp"
+#include "Core/GitIgnore.hpp"
+
+namespace Litr {
+
+// Tells which files changed inside watched directories, including every directory below
+// that git does not ignore. Directories created later on are watched as well. Files are
+// only watched on Linux so far, through inotify.
+class FileWatcher {
+ public:
+  using Files = std::vector<std::string>;
+
+  FileWatcher();
+
+  // Neither copy nor move, the watches belong to this instance only.
+  FileWatcher(const FileWatcher&) = delete;
+  FileWatcher(FileWatcher&&) = delete;
+  FileWatcher& operator=(const FileWatcher&) = delete;
+  FileWatcher& operator=(FileWatcher&&) = delete;
+  ~FileWatcher();
+
+  [[nodiscard]] static bool is_supported();
+
+  void add_directory(const Path& directory);
+
+  // Blocks until a file changed, then keeps collecting until nothing changed for the quiet
+  // period, so a burst of changes (e.g. a branch switch) is reported only once. If changes
+  // got lost, because too many happened at once, the watched directory itself is reported.
+  [[nodiscard]] Files wait(std::chrono::milliseconds quiet_period);
+  // Tells if a file changed since the last wait, without blocking.
+  [[nodiscard]] bool has_changes();
+
+ private:
+  struct Root {
+    std::string path{};
+    GitIgnore ignore{};
+  };
+
+  struct Directory {
+    std::string path{};
+    size_t root{0};
+  };
+
+  void watch_tree(const std::string& directory, size_t root);
+  void watch(const std::string& directory, size_t root);
+  void read_changes();
+  [[nodiscard]] bool is_ignored(const Directory& directory,
+      const std::string& name,
+      bool is_directory) const;
+
+  int m_file_descriptor{-1};
+  std::vector<Root> m_roots{};
+  std::unordered_map<int, Directory> m_directories{};
+  std::set<std::string> m_changes{};
+};
+
+}  // namespace Litr
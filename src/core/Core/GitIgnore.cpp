@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "GitIgnore.hpp"
+
+#include <deque>
+
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/Utils.hpp"
+
+namespace Litr {
+
+void GitIgnore::add_rules(std::string_view directory, std::string_view contents) {
+  LITR_PROFILE_FUNCTION();
+
+  std::deque<std::string_view> lines{};
+  Utils::split_into(contents, '\n', lines);
+
+  for (std::string_view line : lines) {
+    line = Utils::trim_right(Utils::trim_right(line, '\r'), ' ');
+    if (line.empty() || line.front() == '#') {
+      continue;
+    }
+
+    Rule rule{std::string{directory}};
+
+    if (line.front() == '!') {
+      rule.is_negated = true;
+      line.remove_prefix(1);
+    } else if (line.front() == '\\') {
+      // Escaped patterns starting with `#` or `!`.
+      line.remove_prefix(1);
+    }
+
+    if (!line.empty() && line.back() == '/') {
+      rule.is_directory_only = true;
+      line = Utils::trim_right(line, '/');
+    }
+
+    // A slash anywhere but at the end binds the pattern to the directory of the file.
+    if (line.find('/') != std::string_view::npos) {
+      rule.is_anchored = true;
+      line = Utils::trim_left(line, '/');
+    }
+
+    if (line.empty()) {
+      continue;
+    }
+
+    rule.pattern = std::string{line};
+    m_rules.push_back(std::move(rule));
+  }
+}
+
+bool GitIgnore::is_ignored(std::string_view path, bool is_directory) const {
+  LITR_PROFILE_FUNCTION();
+
+  bool is_ignored{false};
+
+  for (auto&& rule : m_rules) {
+    if (rule.is_directory_only && !is_directory) {
+      continue;
+    }
+
+    if (rule.is_negated == is_ignored && matches(rule, path)) {
+      is_ignored = !rule.is_negated;
+    }
+  }
+
+  return is_ignored;
+}
+
+bool GitIgnore::matches(const Rule& rule, std::string_view path) {
+  LITR_PROFILE_FUNCTION();
+
+  if (!rule.directory.empty()) {
+    const size_t length{rule.directory.size()};
+    if (path.size() <= length || path.substr(0, length) != rule.directory || path[length] != '/') {
+      return false;
+    }
+    path.remove_prefix(length + 1);
+  }
+
+  if (rule.is_anchored) {
+    return Utils::matches_glob(path, rule.pattern);
+  }
+
+  // Patterns without a slash match the name on any level.
+  const size_t name_start{path.rfind('/')};
+  return Utils::matches_wildcard(
+      name_start == std::string_view::npos ? path : path.substr(name_start + 1), rule.pattern);
+}
+
+}  // namespace Litr
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Litr {
+
+// Rules of `.gitignore` files, to tell which paths git would not look at. Paths are
+// relative to the directory walked and separated by slashes. Rules only apply below
+// the directory of their file, later rules take precedence over earlier ones.
+class GitIgnore {
+ public:
+  // Adds the rules of a `.gitignore` file inside the given relative directory.
+  void add_rules(std::string_view directory, std::string_view contents);
+
+  [[nodiscard]] bool is_ignored(std::string_view path, bool is_directory) const;
+
+  [[nodiscard]] inline bool empty() const {
+    return m_rules.empty();
+  }
+
+ private:
+  struct Rule {
+    std::string directory{};
+    std::string pattern{};
+    bool is_negated{false};
+    bool is_directory_only{false};
+    bool is_anchored{false};
+  };
+
+  [[nodiscard]] static bool matches(const Rule& rule, std::string_view path);
+
+  std::vector<Rule> m_rules{};
+};
+
+}  // namespace Litr
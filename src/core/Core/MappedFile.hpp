@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "Core/FileSystem.hpp"
+
+namespace Litr {
+
+// Read-only contents of a whole file. Where the platform supports it the file is mapped
+// into memory instead of read, so nothing gets copied until it is used. A mapping follows
+// changes of the file, contents used after it could be written must be copied.
+class MappedFile {
+ public:
+  explicit MappedFile(const Path& path);
+
+  // Neither copy nor move, the contents are handed out as views.
+  MappedFile(const MappedFile&) = delete;
+  MappedFile(MappedFile&&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile& operator=(MappedFile&&) = delete;
+  ~MappedFile();
+
+  [[nodiscard]] inline bool is_open() const {
+    return m_open;
+  }
+  [[nodiscard]] inline std::string_view get_contents() const {
+    return {m_data, m_size};
+  }
+
+ private:
+  const char* m_data{""};
+  size_t m_size{0};
+  bool m_open{false};
+  bool m_mapped{false};
+
+  // Holds the contents on platforms that cannot map files.
+  std::string m_buffer{};
+};
+
+}  // namespace Litr
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Litr {
+
+// Runs a command on the default shell in a process of its own, with limits applied right
+// before the shell starts. Processes are only started this way on Linux and macOS so far.
+class Process {
+ public:
+  using Output = std::function<void(const std::string&)>;
+  // Asked while the command runs, the command ends once it tells so.
+  using CancelCheck = std::function<bool()>;
+
+  // Limits not given are the ones of the calling process, the shell and everything it
+  // starts inherit them.
+  struct Limits {
+    std::optional<int> nice{};
+    // Only bound to on Linux, ignored everywhere else.
+    std::vector<size_t> cpus{};
+    // Address space of each process in bytes.
+    std::optional<uint64_t> memory{};
+    std::optional<uint64_t> open_files{};
+    // Time the command may run for, it runs in a process group of its own to end it and
+    // everything it started once the time is up. The group reads nothing from a terminal.
+    std::chrono::seconds timeout{0};
+
+    [[nodiscard]] inline bool empty() const {
+      return !nice.has_value() && cpus.empty() && !memory.has_value() &&
+             !open_files.has_value() && timeout.count() == 0;
+    }
+  };
+
+  struct Result {
+    int exit_code{-1};
+    bool timed_out{false};
+    bool cancelled{false};
+  };
+
+  // Ends a process group once its time is up or once asked to, first asking it to terminate
+  // and killing it if it did not after a grace period. Watching ends with this instance.
+  class Watchdog {
+   public:
+    // Without a timeout the group is only ended when asked to.
+    Watchdog(int process_group, std::chrono::seconds timeout);
+
+    // Neither copy nor move, the thread watching refers to this instance.
+    Watchdog(const Watchdog&) = delete;
+    Watchdog(Watchdog&&) = delete;
+    Watchdog& operator=(const Watchdog&) = delete;
+    Watchdog& operator=(Watchdog&&) = delete;
+    ~Watchdog();
+
+    [[nodiscard]] bool has_fired() const;
+    // Ends the group right away, the same way it ends once the time is up.
+    void end();
+
+   private:
+    void watch(int process_group, std::chrono::seconds timeout);
+
+    std::mutex m_mutex{};
+    std::condition_variable m_stopped{};
+    // Guarded by the mutex.
+    bool m_is_stopped{false};
+    bool m_is_ending{false};
+    std::atomic<bool> m_has_fired{false};
+    std::thread m_thread{};
+  };
+
+  // Passes signals ending Litr, e.g. an interrupt from the terminal, on to a process group
+  // as long as this instance exists. A group of its own does not get them otherwise.
+  class SignalRelay {
+   public:
+    explicit SignalRelay(int process_group);
+
+    // Neither copy nor move, the group is forgotten exactly once.
+    SignalRelay(const SignalRelay&) = delete;
+    SignalRelay(SignalRelay&&) = delete;
+    SignalRelay& operator=(const SignalRelay&) = delete;
+    SignalRelay& operator=(SignalRelay&&) = delete;
+    ~SignalRelay();
+
+   private:
+    // Place in the list of groups signals are passed on to, none if it was full.
+    std::optional<size_t> m_index{};
+  };
+
+  [[nodiscard]] static bool is_supported();
+
+  // The output of the command is passed on as it comes, standard error included. A command
+  // its limits could not be applied to does not run, and fails. A command that can be
+  // cancelled runs in a process group of its own, the same way one with a timeout does.
+  [[nodiscard]] static Result run(const std::string& command,
+      const Limits& limits,
+      const Output& output,
+      const CancelCheck& cancel_check = {});
+
+  // Applies the limits to the calling process, meant for a new process before it starts a
+  // command. Nothing gets allocated, so it is safe to call between `fork` and `exec`. A
+  // process with a timeout, or asked to, becomes the leader of a new process group.
+  [[nodiscard]] static bool apply(const Limits& limits, bool is_grouped = false);
+
+ private:
+  // Passes on the output until the command closes it, or shortly after the process ended
+  // once the watchdog fired. The cancel check is asked in between, it tells if it ended the
+  // group.
+  [[nodiscard]] static bool read_output(int descriptor,
+      int process,
+      Watchdog* watchdog,
+      const Output& output,
+      const CancelCheck& cancel_check);
+};
+
+}  // namespace Litr
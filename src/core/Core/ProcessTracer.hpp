@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Core/Process.hpp"
+
+namespace Litr {
+
+// Runs a command on the default shell and records every file it, or any process it starts,
+// opens, executes or asks for, including files that do not exist. Processes are only
+// traced on Linux so far, through ptrace.
+class ProcessTracer {
+ public:
+  using Output = std::function<void(const std::string&)>;
+
+  struct Result {
+    int exit_code{-1};
+    // Absolute and sorted, without virtual files like the ones in `/proc`.
+    std::vector<std::string> files{};
+    bool timed_out{false};
+    bool cancelled{false};
+  };
+
+  [[nodiscard]] static bool is_supported();
+
+  // The output of the command is passed on as it comes, standard error included. Limits
+  // apply to the traced processes the same way `Process` applies them, so does cancelling.
+  [[nodiscard]] static Result run(const std::string& command,
+      const Process::Limits& limits,
+      const Output& output,
+      const Process::CancelCheck& cancel_check = {});
+};
+
+}  // namespace Litr
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <utility>
 
+#include "Core/Debug/AllocationTracker.hpp"
 #include "Core/Debug/Instrumentor.hpp"
 #include "Core/Error/Handler.hpp"
 #include "Core/Utils.hpp"
@@ -20,6 +21,7 @@ Compiler::Compiler(const std::string& source, Config::Location location, Variabl
       m_location(std::move(location)),
       m_variables(std::move(variables)) {
   LITR_PROFILE_FUNCTION();
+  LITR_ALLOCATION_PHASE(SCRIPT_COMPILE);
 
   advance();
   source_token();
@@ -273,8 +275,12 @@ void Compiler::error_at(Token* token, const std::string& message) {
 
   out_message.append(fmt::format(": {}", message));
 
-  Error::Handler::push(Error::ScriptParserError(
-      out_message, m_location.line, m_location.column + token->column + 1, m_location.line_str));
+  // Errors point into the configuration file the script is written in.
+  Error::Handler::push(Error::ScriptParserError(out_message,
+      {m_location.line,
+          m_location.column + token->column + 1,
+          m_location.line_str,
+          m_location.file}));
 }
 
 }  // namespace Litr::Script
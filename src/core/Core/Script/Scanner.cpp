@@ -10,7 +10,10 @@
 
 namespace Litr::Script {
 
-Scanner::Scanner(const char* source) : m_start(source), m_current(source) {}
+Scanner::Scanner(const char* source)
+    : m_start(source),
+      m_current(source),
+      m_end(source + std::strlen(source)) {}
 
 void Scanner::skip_whitespace() {
   LITR_PROFILE_FUNCTION();
@@ -37,14 +40,10 @@ void Scanner::skip_whitespace() {
 }
 
 char Scanner::peek() const {
-  LITR_PROFILE_FUNCTION();
-
   return *m_current;
 }
 
 char Scanner::peek_next() const {
-  LITR_PROFILE_FUNCTION();
-
   if (is_at_end()) {
     return '\0';
   }
@@ -53,16 +52,12 @@ char Scanner::peek_next() const {
 }
 
 char Scanner::advance() {
-  LITR_PROFILE_FUNCTION();
-
   ++m_current;
   ++m_column;
   return m_current[-1];
 }
 
 bool Scanner::match(const char expected) {
-  LITR_PROFILE_FUNCTION();
-
   if (is_at_end()) {
     return false;
   }
@@ -79,7 +74,7 @@ bool Scanner::match(const char expected) {
 Token Scanner::scan_token() {
   LITR_PROFILE_FUNCTION();
 
-  switch (m_modes.top()) {
+  switch (m_modes.at(m_mode_depth - 1)) {
     case Mode::UNTOUCHED:
       return scan_untouched_token();
     case Mode::EXPRESSION:
@@ -140,41 +135,29 @@ Token Scanner::scan_expression_token() {
   }
 }
 
-std::string Scanner::get_token_value(const Token& token) {
-  LITR_PROFILE_FUNCTION();
-
+std::string_view Scanner::get_token_value(const Token& token) {
   return {token.start, token.length};
 }
 
-std::string Scanner::get_token_value(Token* token) {
-  LITR_PROFILE_FUNCTION();
-
+std::string_view Scanner::get_token_value(Token* token) {
   return {token->start, token->length};
 }
 
 Token Scanner::make_token(const TokenType type) const {
-  LITR_PROFILE_FUNCTION();
-
   Token token{type, m_start, static_cast<size_t>(m_current - m_start), m_line, m_column};
   return token;
 }
 
 Token Scanner::error_token(const char* message) const {
-  LITR_PROFILE_FUNCTION();
-
   Token token{TokenType::ERROR, message, strlen(message), m_line, m_column};
   return token;
 }
 
 bool Scanner::is_digit(char character) {
-  LITR_PROFILE_FUNCTION();
-
   return character >= '0' && character <= '9';
 }
 
 bool Scanner::is_alpha(char character) {
-  LITR_PROFILE_FUNCTION();
-
   return (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') ||
          character == '_';
 }
@@ -184,30 +167,47 @@ bool Scanner::is_hyphen(char character) {
 }
 
 bool Scanner::is_at_end() const {
-  LITR_PROFILE_FUNCTION();
-
   return *m_current == '\0';
 }
 
 Token Scanner::start_sequence() {
   LITR_PROFILE_FUNCTION();
 
-  m_modes.push(Mode::EXPRESSION);
+  if (m_mode_depth == max_mode_depth) {
+    return error_token("Sequences are nested too deep.");
+  }
+
+  m_modes.at(m_mode_depth++) = Mode::EXPRESSION;
   return make_token(TokenType::START_SEQ);
 }
 
 Token Scanner::end_sequence() {
   LITR_PROFILE_FUNCTION();
 
-  m_modes.pop();
+  // The untouched mode at the bottom is never left.
+  if (m_mode_depth > 1) {
+    --m_mode_depth;
+  }
   return make_token(TokenType::END_SEQ);
 }
 
 Token Scanner::untouched() {
   LITR_PROFILE_FUNCTION();
 
-  // @todo: Refactor this condition for the check `m_Current[-1] != '\\'` of the escape sequence.
-  while (!(peek() == '%' && peek_next() == '{' && m_current[-1] != '\\') && !is_at_end()) {
+  // Only a `%{` not escaped by a backslash ends an untouched run, so instead of looking at
+  // every character the search jumps from one percent sign to the next.
+  for (;;) {
+    const auto* percent{static_cast<const char*>(
+        std::memchr(m_current, '%', static_cast<size_t>(m_end - m_current)))};
+    const char* stop{percent == nullptr ? m_end : percent};
+
+    m_column += static_cast<uint32_t>(stop - m_current);
+    m_current = stop;
+
+    if (is_at_end() || (peek_next() == '{' && m_current[-1] != '\\')) {
+      break;
+    }
+
     advance();
   }
 
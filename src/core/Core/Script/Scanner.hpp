@@ -4,8 +4,9 @@
 
 #pragma once
 
-#include <stack>
-#include <string>
+#include <array>
+#include <cstdint>
+#include <string_view>
 
 #include "Core/Script/Token.hpp"
 
@@ -19,8 +20,8 @@ class Scanner {
   [[nodiscard]] Token scan_untouched_token();
   [[nodiscard]] Token scan_expression_token();
 
-  [[nodiscard]] static std::string get_token_value(const Token& token);
-  [[nodiscard]] static std::string get_token_value(Token* token);
+  [[nodiscard]] static std::string_view get_token_value(const Token& token);
+  [[nodiscard]] static std::string_view get_token_value(Token* token);
 
  private:
   enum class Mode { UNTOUCHED, EXPRESSION };
@@ -51,11 +52,15 @@ class Scanner {
 
   const char* m_start;
   const char* m_current;
+  const char* m_end;
 
   uint32_t m_line{1};
   uint32_t m_column{1};
 
-  std::stack<Mode> m_modes{{Mode::UNTOUCHED}};
+  // Sequences cannot nest, a fixed size stack is enough and does not allocate.
+  static constexpr size_t max_mode_depth{4};
+  std::array<Mode, max_mode_depth> m_modes{Mode::UNTOUCHED};
+  size_t m_mode_depth{1};
 };
 
 }  // namespace Litr::Script
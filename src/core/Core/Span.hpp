@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace Litr {
+
+// Non-owning view on a contiguous sequence of values, until C++20 brings `std::span`.
+template <typename T>
+class Span {
+ public:
+  using Iterator = T*;
+
+  Span() = default;
+  Span(T* data, size_t size) : m_data(data), m_size(size) {}
+
+  // Allow a view on mutable values to be used as view on constant values.
+  template <typename U, typename = std::enable_if_t<std::is_same_v<const U, T>>>
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  Span(const Span<U>& other) : m_data(other.data()), m_size(other.size()) {}
+
+  [[nodiscard]] T* data() const {
+    return m_data;
+  }
+  [[nodiscard]] size_t size() const {
+    return m_size;
+  }
+  [[nodiscard]] bool empty() const {
+    return m_size == 0;
+  }
+
+  [[nodiscard]] T& operator[](size_t index) const {
+    return m_data[index];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+  [[nodiscard]] T& front() const {
+    return m_data[0];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+  [[nodiscard]] T& back() const {
+    return m_data[m_size - 1];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+  [[nodiscard]] Iterator begin() const {
+    return m_data;
+  }
+  [[nodiscard]] Iterator end() const {
+    return m_data + m_size;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+ private:
+  T* m_data{nullptr};
+  size_t m_size{0};
+};
+
+}  // namespace Litr
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "StringPool.hpp"
+
+#include <algorithm>
+
+#include "Core/Debug/Instrumentor.hpp"
+
+namespace Litr {
+
+std::string_view StringPool::intern(std::string_view value) {
+  LITR_PROFILE_FUNCTION();
+
+  // An empty allocation would share its address with the next string interned.
+  if (value.empty()) {
+    return {""};
+  }
+
+  const auto existing{m_strings.find(value)};
+  if (existing != m_strings.end()) {
+    return *existing;
+  }
+
+  const Span<char> characters{m_characters.allocate(value.size())};
+  std::copy(value.begin(), value.end(), characters.begin());
+
+  const std::string_view interned{characters.data(), characters.size()};
+  m_strings.insert(interned);
+  return interned;
+}
+
+size_t StringPool::size() const {
+  return m_strings.size();
+}
+
+}  // namespace Litr
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <string_view>
+#include <unordered_set>
+
+#include "Core/Arena.hpp"
+
+namespace Litr {
+
+// Stores every distinct string once. Interned strings stay valid for the lifetime
+// of the pool and equal strings share the same memory.
+class StringPool {
+ public:
+  StringPool() = default;
+
+  [[nodiscard]] std::string_view intern(std::string_view value);
+  [[nodiscard]] size_t size() const;
+
+ private:
+  static constexpr size_t chunk_size{16 * 1024};
+
+  Arena<char> m_characters{chunk_size};
+  std::unordered_set<std::string_view> m_strings{};
+};
+
+}  // namespace Litr
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+namespace Litr {
+
+// How busy the machine is right now, shared with every other process running on it. Only
+// read on Linux so far, from `/proc`, everything else knows nothing.
+class SystemLoad {
+ public:
+  // Values a system does not provide, e.g. pressure without a kernel supporting it, are
+  // left empty. Pressure is the share of the last ten seconds in percent some task stalled.
+  struct Sample {
+    std::optional<double> load_average{};
+    std::optional<double> cpu_pressure{};
+    std::optional<double> memory_pressure{};
+    std::optional<double> io_pressure{};
+    std::optional<uint64_t> memory_available{};
+    std::optional<uint64_t> memory_total{};
+  };
+
+  [[nodiscard]] static Sample read();
+};
+
+}  // namespace Litr
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "ThreadPool.hpp"
+
+#include "Core/Debug/Instrumentor.hpp"
+
+namespace Litr {
+
+ThreadPool::ThreadPool(size_t threads) {
+  LITR_PROFILE_FUNCTION();
+
+  m_workers.reserve(threads);
+  for (size_t thread{0}; thread < threads; ++thread) {
+    m_workers.emplace_back([this]() { work(); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard lock{m_mutex};
+    m_stop = true;
+  }
+  m_wake.notify_all();
+
+  for (auto&& worker : m_workers) {
+    worker.join();
+  }
+}
+
+void ThreadPool::run(size_t count, const Task& task) {
+  LITR_PROFILE_FUNCTION();
+
+  if (count == 0) {
+    return;
+  }
+
+  // Not worth waking anyone up for a single task.
+  if (count == 1 || m_workers.empty()) {
+    for (size_t index{0}; index < count; ++index) {
+      task(index);
+    }
+    return;
+  }
+
+  {
+    std::lock_guard lock{m_mutex};
+    m_task = &task;
+    m_count = count;
+    m_next = 0;
+    m_active = m_workers.size();
+    ++m_generation;
+  }
+  m_wake.notify_all();
+
+  run_tasks();
+
+  std::unique_lock lock{m_mutex};
+  m_done.wait(lock, [this]() { return m_active == 0; });
+  m_task = nullptr;
+}
+
+size_t ThreadPool::get_default_size() {
+  // The calling thread works as well, so one less is enough to use every core.
+  const size_t cores{std::thread::hardware_concurrency()};
+  return cores > 1 ? cores - 1 : 0;
+}
+
+void ThreadPool::work() {
+  size_t generation{0};
+
+  for (;;) {
+    {
+      std::unique_lock lock{m_mutex};
+      m_wake.wait(lock, [&]() { return m_stop || m_generation != generation; });
+      if (m_stop) {
+        return;
+      }
+      generation = m_generation;
+    }
+
+    run_tasks();
+
+    {
+      std::lock_guard lock{m_mutex};
+      --m_active;
+    }
+    m_done.notify_one();
+  }
+}
+
+void ThreadPool::run_tasks() {
+  // The task and count only change while no worker is active.
+  const Task& task{*m_task};
+  const size_t count{m_count};
+
+  for (size_t index{m_next.fetch_add(1)}; index < count; index = m_next.fetch_add(1)) {
+    task(index);
+  }
+}
+
+}  // namespace Litr
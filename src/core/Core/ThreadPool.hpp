@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Litr {
+
+// Runs the same task for a range of indices on a fixed set of worker threads. The
+// calling thread takes part in the work and waits until every index is done.
+class ThreadPool {
+ public:
+  using Task = std::function<void(size_t index)>;
+
+  // A pool of zero threads runs everything on the calling thread.
+  explicit ThreadPool(size_t threads = get_default_size());
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool& operator=(ThreadPool&&) = delete;
+  ~ThreadPool();
+
+  // Tasks must not throw, and must not run other work on the same pool.
+  void run(size_t count, const Task& task);
+
+  [[nodiscard]] inline size_t size() const {
+    return m_workers.size();
+  }
+
+  [[nodiscard]] static size_t get_default_size();
+
+ private:
+  void work();
+  void run_tasks();
+
+  std::vector<std::thread> m_workers{};
+  std::mutex m_mutex{};
+  std::condition_variable m_wake{};
+  std::condition_variable m_done{};
+
+  // Guarded by the mutex.
+  const Task* m_task{nullptr};
+  size_t m_generation{0};
+  size_t m_active{0};
+  bool m_stop{false};
+
+  size_t m_count{0};
+  std::atomic<size_t> m_next{0};
+};
+
+}  // namespace Litr
@@ -4,54 +4,65 @@
 
 #include "Utils.hpp"
 
+#include <fmt/format.h>
+
 #include <algorithm>
+#include <cctype>
+#include <limits>
 
 #include "Core/Debug/Instrumentor.hpp"
 
 namespace Litr::Utils {
 
-std::string trim_left(const std::string& src, char character) {
+std::string_view trim_left(std::string_view src, char character) {
   LITR_PROFILE_FUNCTION();
 
-  std::string out{src};
-  out.erase(0, out.find_first_not_of(character));
-  return out;
+  const size_t start{src.find_first_not_of(character)};
+  return start == std::string_view::npos ? std::string_view{} : src.substr(start);
 }
 
-std::string trim_right(const std::string& src, char character) {
+std::string_view trim_right(std::string_view src, char character) {
   LITR_PROFILE_FUNCTION();
 
-  std::string out{src};
-  out.erase(out.find_last_not_of(character) + 1);
-  return out;
+  const size_t end{src.find_last_not_of(character)};
+  return end == std::string_view::npos ? std::string_view{} : src.substr(0, end + 1);
 }
 
-std::string trim(const std::string& src, char character) {
+std::string_view trim(std::string_view src, char character) {
   LITR_PROFILE_FUNCTION();
 
   return trim_left(trim_right(src, character), character);
 }
 
-void split_into(const std::string& source, const char& delimiter, std::vector<std::string>& out) {
+/** @private */
+template <typename Container>
+static void split_into_container(std::string_view source, char delimiter, Container& out) {
   LITR_PROFILE_FUNCTION();
 
-  std::stringstream ss{source};
-  std::string part{};
+  // Same as splitting with `std::getline`, a trailing delimiter does not add an empty part.
+  size_t start{0};
+  while (start < source.size()) {
+    const size_t end{source.find(delimiter, start)};
+    if (end == std::string_view::npos) {
+      out.emplace_back(source.substr(start));
+      return;
+    }
 
-  while (std::getline(ss, part, delimiter)) {
-    out.push_back(part);
+    out.emplace_back(source.substr(start, end - start));
+    start = end + 1;
   }
 }
 
-void split_into(const std::string& source, const char& delimiter, std::deque<std::string>& out) {
-  LITR_PROFILE_FUNCTION();
+void split_into(std::string_view source, char delimiter, std::vector<std::string>& out) {
+  split_into_container(source, delimiter, out);
+}
 
-  std::stringstream ss{source};
-  std::string part{};
+void split_into(std::string_view source, char delimiter, std::deque<std::string>& out) {
+  split_into_container(source, delimiter, out);
+}
 
-  while (std::getline(ss, part, delimiter)) {
-    out.push_back(part);
-  }
+void split_into(std::string_view source, char delimiter, std::deque<std::string_view>& out) {
+  split_into_container(source, delimiter, out);
 }
 
 void deduplicate(std::vector<std::string>& items) {
@@ -74,4 +85,247 @@ std::string replace(const std::string& source, const std::string& from, const st
   return extract;
 }
 
+bool matches_wildcard(std::string_view source, std::string_view pattern) {
+  LITR_PROFILE_FUNCTION();
+
+  size_t source_index{0};
+  size_t pattern_index{0};
+  // Position of the last `*` and the source position it got matched up to, to backtrack.
+  size_t star{std::string_view::npos};
+  size_t star_source{0};
+
+  while (source_index < source.size()) {
+    if (pattern_index < pattern.size() &&
+        (pattern[pattern_index] == '?' || pattern[pattern_index] == source[source_index])) {
+      ++source_index;
+      ++pattern_index;
+    } else if (pattern_index < pattern.size() && pattern[pattern_index] == '*') {
+      star = pattern_index++;
+      star_source = source_index;
+    } else if (star != std::string_view::npos) {
+      pattern_index = star + 1;
+      source_index = ++star_source;
+    } else {
+      return false;
+    }
+  }
+
+  while (pattern_index < pattern.size() && pattern[pattern_index] == '*') {
+    ++pattern_index;
+  }
+
+  return pattern_index == pattern.size();
+}
+
+/** @private */
+static bool matches_part(std::string_view part, std::string_view pattern, bool match_hidden) {
+  if (!match_hidden && !part.empty() && part.front() == '.' &&
+      (pattern.empty() || pattern.front() != '.')) {
+    return false;
+  }
+
+  return matches_wildcard(part, pattern);
+}
+
+/** @private */
+// NOLINTNEXTLINE(misc-no-recursion)
+static bool matches_parts(const std::deque<std::string_view>& path,
+    size_t path_index,
+    const std::deque<std::string_view>& pattern,
+    size_t pattern_index,
+    bool is_start,
+    bool match_hidden) {
+  if (pattern_index == pattern.size()) {
+    return !is_start && path_index == path.size();
+  }
+
+  if (pattern[pattern_index] == "**") {
+    for (size_t next{path_index}; next <= path.size(); ++next) {
+      if (next > path_index && !matches_part(path[next - 1], "*", match_hidden)) {
+        return false;
+      }
+
+      // A double star can take up everything that follows as well.
+      // NOLINTNEXTLINE(misc-no-recursion)
+      if ((is_start && next == path.size()) ||
+          matches_parts(path, next, pattern, pattern_index + 1, is_start, match_hidden)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  if (path_index == path.size()) {
+    return is_start;
+  }
+
+  // NOLINTNEXTLINE(misc-no-recursion)
+  return matches_part(path[path_index], pattern[pattern_index], match_hidden) &&
+         matches_parts(path, path_index + 1, pattern, pattern_index + 1, is_start, match_hidden);
+}
+
+bool matches_glob(std::string_view path, std::string_view pattern, bool match_hidden) {
+  LITR_PROFILE_FUNCTION();
+
+  std::deque<std::string_view> path_parts{};
+  std::deque<std::string_view> pattern_parts{};
+  split_into(path, '/', path_parts);
+  split_into(pattern, '/', pattern_parts);
+
+  return matches_parts(path_parts, 0, pattern_parts, 0, false, match_hidden);
+}
+
+bool matches_glob_start(std::string_view path, std::string_view pattern, bool match_hidden) {
+  LITR_PROFILE_FUNCTION();
+
+  std::deque<std::string_view> path_parts{};
+  std::deque<std::string_view> pattern_parts{};
+  split_into(path, '/', path_parts);
+  split_into(pattern, '/', pattern_parts);
+
+  return matches_parts(path_parts, 0, pattern_parts, 0, true, match_hidden);
+}
+
+std::optional<std::chrono::seconds> parse_duration(std::string_view value) {
+  LITR_PROFILE_FUNCTION();
+
+  // Durations are waited for with clocks counting nanoseconds, longer ones overflow those.
+  constexpr std::chrono::seconds max_duration{
+      std::chrono::duration_cast<std::chrono::seconds>(std::chrono::nanoseconds::max())};
+
+  if (value.empty()) {
+    return std::nullopt;
+  }
+
+  std::chrono::seconds duration{0};
+
+  while (!value.empty()) {
+    size_t digits{0};
+    while (digits < value.size() && std::isdigit(static_cast<unsigned char>(value[digits]))) {
+      ++digits;
+    }
+
+    const std::optional<std::chrono::seconds::rep> count{
+        parse_number<std::chrono::seconds::rep>(value.substr(0, digits))};
+    if (!count.has_value() || digits == value.size()) {
+      return std::nullopt;
+    }
+
+    std::chrono::seconds unit{};
+    switch (value[digits]) {
+      case 's': {
+        unit = std::chrono::seconds{1};
+        break;
+      }
+      case 'm': {
+        unit = std::chrono::minutes{1};
+        break;
+      }
+      case 'h': {
+        unit = std::chrono::hours{1};
+        break;
+      }
+      case 'd': {
+        constexpr std::chrono::hours::rep hours_per_day{24};
+        unit = std::chrono::hours{hours_per_day};
+        break;
+      }
+      default: {
+        return std::nullopt;
+      }
+    }
+
+    if (*count > (max_duration - duration) / unit) {
+      return std::nullopt;
+    }
+
+    duration += *count * unit;
+    value.remove_prefix(digits + 1);
+  }
+
+  return duration;
+}
+
+std::optional<uint64_t> parse_size(std::string_view value) {
+  LITR_PROFILE_FUNCTION();
+
+  constexpr std::string_view units{"KMGT"};
+  constexpr uint64_t unit_base{1024};
+
+  uint64_t factor{1};
+  if (!value.empty() && !std::isdigit(static_cast<unsigned char>(value.back()))) {
+    const size_t unit{units.find(value.back())};
+    if (unit == std::string_view::npos) {
+      return std::nullopt;
+    }
+
+    for (size_t power{0}; power <= unit; ++power) {
+      factor *= unit_base;
+    }
+    value.remove_suffix(1);
+  }
+
+  const std::optional<uint64_t> count{parse_number<uint64_t>(value)};
+  if (!count.has_value() || *count > std::numeric_limits<uint64_t>::max() / factor) {
+    return std::nullopt;
+  }
+
+  return *count * factor;
+}
+
+std::optional<std::vector<size_t>> parse_cpus(std::string_view value) {
+  LITR_PROFILE_FUNCTION();
+
+  // Same as the most CPUs a Linux process can be bound to.
+  constexpr size_t max_cpus{1024};
+
+  std::deque<std::string_view> parts{};
+  split_into(value, ',', parts);
+  if (parts.empty()) {
+    return std::nullopt;
+  }
+
+  std::vector<size_t> cpus{};
+  for (const std::string_view part : parts) {
+    const size_t separator{part.find('-')};
+    const std::optional<size_t> first{parse_number<size_t>(part.substr(0, separator))};
+    const std::optional<size_t> last{separator == std::string_view::npos
+                                         ? first
+                                         : parse_number<size_t>(part.substr(separator + 1))};
+
+    if (!first.has_value() || !last.has_value() || *first > *last || *last >= max_cpus) {
+      return std::nullopt;
+    }
+
+    for (size_t cpu{*first}; cpu <= *last; ++cpu) {
+      cpus.push_back(cpu);
+    }
+  }
+
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+
+  return cpus;
+}
+
+uint64_t hash(std::string_view data, uint64_t seed) {
+  LITR_PROFILE_FUNCTION();
+
+  constexpr uint64_t prime{1099511628211ULL};
+  uint64_t result{seed};
+
+  for (const char character : data) {
+    result ^= static_cast<unsigned char>(character);
+    result *= prime;
+  }
+
+  return result;
+}
+
+std::string to_hex(uint64_t hash) {
+  LITR_PROFILE_FUNCTION();
+
+  return fmt::format("{:016x}", hash);
+}
+
 }  // namespace Litr::Utils
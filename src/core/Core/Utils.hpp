@@ -4,22 +4,76 @@
 
 #pragma once
 
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
 #include <deque>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <system_error>
 #include <vector>
 
 namespace Litr::Utils {
 
-[[nodiscard]] std::string trim_left(const std::string& src, char character);
-[[nodiscard]] std::string trim_right(const std::string& src, char character);
-[[nodiscard]] std::string trim(const std::string& src, char character);
+// Trimming returns a view on the given source, it must outlive the result.
+[[nodiscard]] std::string_view trim_left(std::string_view src, char character);
+[[nodiscard]] std::string_view trim_right(std::string_view src, char character);
+[[nodiscard]] std::string_view trim(std::string_view src, char character);
 
-void split_into(const std::string& source, const char& delimiter, std::vector<std::string>& out);
-void split_into(const std::string& source, const char& delimiter, std::deque<std::string>& out);
+void split_into(std::string_view source, char delimiter, std::vector<std::string>& out);
+void split_into(std::string_view source, char delimiter, std::deque<std::string>& out);
+void split_into(std::string_view source, char delimiter, std::deque<std::string_view>& out);
 
 void deduplicate(std::vector<std::string>& items);
 
 std::string replace(const std::string& source, const std::string& from, const std::string& to);
 
+// Matches the whole source against a pattern, where `*` stands for any number of
+// characters and `?` for exactly one.
+[[nodiscard]] bool matches_wildcard(std::string_view source, std::string_view pattern);
+
+// Matches a slash separated path part by part as of `matches_wildcard`, where a part
+// consisting of `**` only stands for any number of parts, including none. Without
+// `match_hidden` parts starting with a dot only match pattern parts that do as well.
+[[nodiscard]] bool matches_glob(
+    std::string_view path, std::string_view pattern, bool match_hidden = true);
+// Tells if a longer path starting with the given one could match, e.g. to know which
+// directories are worth looking into.
+[[nodiscard]] bool matches_glob_start(
+    std::string_view path, std::string_view pattern, bool match_hidden = true);
+
+// Parses a number made of nothing but digits, nothing if it does not fit into the type.
+template <typename T>
+[[nodiscard]] std::optional<T> parse_number(std::string_view value) {
+  // Signed types would take a minus sign as well.
+  if (value.empty() || std::isdigit(static_cast<unsigned char>(value.front())) == 0) {
+    return std::nullopt;
+  }
+
+  T number{0};
+  const char* end{value.data() + value.size()};
+  const auto [last, error]{std::from_chars(value.data(), end, number)};
+  if (error != std::errc() || last != end) {
+    return std::nullopt;
+  }
+
+  return number;
+}
+
+// Parses a duration like `90s`, `10m`, `2h` or `1d`, units can be combined as in `1h30m`.
+[[nodiscard]] std::optional<std::chrono::seconds> parse_duration(std::string_view value);
+// Parses a size in bytes like `512`, `64K`, `256M`, `4G` or `1T`, units are powers of 1024.
+[[nodiscard]] std::optional<uint64_t> parse_size(std::string_view value);
+// Parses a list of CPU numbers and ranges like `0-7,12`, sorted and without duplicates.
+[[nodiscard]] std::optional<std::vector<size_t>> parse_cpus(std::string_view value);
+
+// Hash staying the same between runs and platforms (64 bit FNV-1a), unlike `std::hash`.
+// More data is added to a hash by passing the previous result as seed.
+[[nodiscard]] uint64_t hash(std::string_view data, uint64_t seed = 14695981039346656037ULL);
+// Hash as fixed length hexadecimal string, e.g. to be used as file name.
+[[nodiscard]] std::string to_hex(uint64_t hash);
+
 }  // namespace Litr::Utils
@@ -17,4 +17,17 @@ Path Environment::get_home_directory() {
   return Path(std::getenv("HOME"));
 }
 
+Path Environment::get_cache_directory() {
+  LITR_PROFILE_FUNCTION();
+
+  // std::getenv is not thread safe, but this will not be a problem here.
+  // NOLINTNEXTLINE(concurrency-mt-unsafe)
+  const char* cache_home{std::getenv("XDG_CACHE_HOME")};
+  if (cache_home != nullptr && *cache_home != '\0') {
+    return Path(cache_home).append(std::string{"litr"});
+  }
+
+  return get_home_directory().append(std::string{".cache/litr"});
+}
+
 }  // namespace Litr
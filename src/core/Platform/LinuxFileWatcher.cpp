@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <filesystem>
+#include <system_error>
+
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/DirectoryWalker.hpp"
+#include "Core/FileWatcher.hpp"
+#include "Core/Log.hpp"
+#include "Core/MappedFile.hpp"
+#include "Core/Utils.hpp"
+
+namespace Litr {
+
+/** @private */
+static std::string get_relative_path(const std::string& root, const std::string& path) {
+  return path.size() > root.size() ? path.substr(root.size() + 1) : "";
+}
+
+FileWatcher::FileWatcher()
+    : m_file_descriptor(inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) {
+  if (m_file_descriptor == -1) {
+    LITR_CORE_ERROR("Could not initialize inotify (errno {})", errno);
+  }
+}
+
+FileWatcher::~FileWatcher() {
+  if (m_file_descriptor != -1) {
+    close(m_file_descriptor);
+  }
+}
+
+bool FileWatcher::is_supported() {
+  return true;
+}
+
+void FileWatcher::add_directory(const Path& directory) {
+  LITR_PROFILE_FUNCTION();
+
+  std::error_code error{};
+  const std::string path{std::filesystem::absolute(directory.to_string(), error).string()};
+
+  m_roots.push_back({std::string{Utils::trim_right(path, '/')}});
+  watch_tree(m_roots.back().path, m_roots.size() - 1);
+}
+
+FileWatcher::Files FileWatcher::wait(std::chrono::milliseconds quiet_period) {
+  LITR_PROFILE_FUNCTION();
+
+  if (m_file_descriptor == -1) {
+    return {};
+  }
+
+  pollfd descriptor{m_file_descriptor, POLLIN, 0};
+
+  // Changes to ignored files wake up as well, but are never reported.
+  while (m_changes.empty()) {
+    if (poll(&descriptor, 1, -1) == -1 && errno != EINTR) {
+      return {};
+    }
+    read_changes();
+  }
+
+  while (poll(&descriptor, 1, static_cast<int>(quiet_period.count())) > 0) {
+    read_changes();
+  }
+
+  Files files{m_changes.begin(), m_changes.end()};
+  m_changes.clear();
+  return files;
+}
+
+bool FileWatcher::has_changes() {
+  LITR_PROFILE_FUNCTION();
+
+  if (m_file_descriptor != -1) {
+    read_changes();
+  }
+
+  return !m_changes.empty();
+}
+
+void FileWatcher::watch_tree(const std::string& directory, size_t root) {
+  LITR_PROFILE_FUNCTION();
+
+  watch(directory, root);
+
+  // The walker only knows ignore rules from the new directory on, not the ones above.
+  const std::string relative_path{get_relative_path(m_roots[root].path, directory)};
+  const GitIgnore& ignore{m_roots[root].ignore};
+
+  DirectoryWalker walker{Path{directory}};
+  walker.set_respect_git_ignore(true);
+  walker.set_directory_filter([&relative_path, &ignore](const DirectoryWalker::Entry& entry) {
+    return !ignore.is_ignored(
+        relative_path.empty() ? entry.relative_path : relative_path + '/' + entry.relative_path,
+        true);
+  });
+
+  const std::vector<DirectoryWalker::Entry> entries{
+      walker.walk([](const DirectoryWalker::Entry& entry) {
+        return entry.is_directory || entry.path.filename() == ".gitignore";
+      })};
+
+  // Entries are sorted by path, rules of a directory come before the ones below.
+  for (auto&& entry : entries) {
+    if (entry.is_directory) {
+      watch(entry.path.to_string(), root);
+      continue;
+    }
+
+    const MappedFile file{entry.path};
+    if (file.is_open()) {
+      const std::string path{entry.path.without_filename().to_string()};
+      m_roots[root].ignore.add_rules(
+          Utils::trim_right(get_relative_path(m_roots[root].path, path), '/'),
+          file.get_contents());
+    }
+  }
+}
+
+void FileWatcher::watch(const std::string& directory, size_t root) {
+  LITR_PROFILE_FUNCTION();
+
+  if (m_file_descriptor == -1) {
+    return;
+  }
+
+  const int descriptor{inotify_add_watch(m_file_descriptor,
+      directory.c_str(),
+      IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR)};
+  if (descriptor == -1) {
+    LITR_CORE_TRACE("Could not watch {} (errno {})", directory, errno);
+    return;
+  }
+
+  m_directories.insert_or_assign(descriptor, Directory{directory, root});
+}
+
+void FileWatcher::read_changes() {
+  LITR_PROFILE_FUNCTION();
+
+  constexpr size_t buffer_size{16384};
+  alignas(inotify_event) std::array<char, buffer_size> buffer{};
+
+  // Reads until nothing is left, the descriptor does not block.
+  while (true) {
+    const ssize_t length{read(m_file_descriptor, buffer.data(), buffer.size())};
+    if (length <= 0) {
+      return;
+    }
+
+    for (size_t offset{0}; offset < static_cast<size_t>(length);) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      const auto* event{reinterpret_cast<const inotify_event*>(&buffer.at(offset))};
+      offset += sizeof(inotify_event) + event->len;
+
+      if ((event->mask & IN_Q_OVERFLOW) != 0) {
+        for (auto&& root : m_roots) {
+          m_changes.insert(root.path);
+        }
+        continue;
+      }
+
+      const auto found{m_directories.find(event->wd)};
+      if (found == m_directories.end()) {
+        continue;
+      }
+
+      if ((event->mask & IN_IGNORED) != 0) {
+        m_directories.erase(found);
+        continue;
+      }
+
+      // Watching a new directory changes the map, the directory is needed afterwards.
+      const Directory directory{found->second};
+      const std::string name{event->len > 0 ? event->name : ""};
+      const bool is_directory{(event->mask & IN_ISDIR) != 0};
+      if (name.empty() || is_ignored(directory, name, is_directory)) {
+        continue;
+      }
+
+      const std::string path{directory.path + '/' + name};
+      if (is_directory && (event->mask & (IN_CREATE | IN_MOVED_TO)) != 0) {
+        watch_tree(path, directory.root);
+      }
+
+      m_changes.insert(path);
+    }
+  }
+}
+
+bool FileWatcher::is_ignored(const Directory& directory,
+    const std::string& name,
+    bool is_directory) const {
+  LITR_PROFILE_FUNCTION();
+
+  if (name == ".git") {
+    return true;
+  }
+
+  const Root& root{m_roots[directory.root]};
+  const std::string relative_path{get_relative_path(root.path, directory.path)};
+
+  return root.ignore.is_ignored(
+      relative_path.empty() ? name : relative_path + '/' + name, is_directory);
+}
+
+}  // namespace Litr
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/Debug/PerfCounter.hpp"
+#include "Core/Log.hpp"
+
+namespace Litr::Debug {
+
+/** @private */
+struct EventDefinition {
+  const char* name;
+  uint32_t type;
+  uint64_t config;
+  PerfCounter::Value::Unit unit;
+};
+
+/** @private */
+static int open_event(const EventDefinition& definition, const bool user_space_only) {
+  perf_event_attr attributes{};
+  attributes.size = sizeof(perf_event_attr);
+  attributes.type = definition.type;
+  attributes.config = definition.config;
+  attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  attributes.disabled = 1;
+  // Inherited counters are summed up into this event as soon as a child exits,
+  // so the shell and everything it starts is part of the result.
+  attributes.inherit = 1;
+  attributes.exclude_kernel = user_space_only ? 1 : 0;
+  attributes.exclude_hv = user_space_only ? 1 : 0;
+
+  // There is no glibc wrapper for perf_event_open.
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+  return static_cast<int>(
+      syscall(SYS_perf_event_open, &attributes, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+}
+
+PerfCounter::~PerfCounter() {
+  close_events();
+}
+
+void PerfCounter::start() {
+  LITR_PROFILE_FUNCTION();
+
+  constexpr std::array<EventDefinition, 5> definitions{
+      {{"task-clock",
+           PERF_TYPE_SOFTWARE,
+           PERF_COUNT_SW_TASK_CLOCK,
+           PerfCounter::Value::Unit::NANOSECONDS},
+          {"page-faults",
+              PERF_TYPE_SOFTWARE,
+              PERF_COUNT_SW_PAGE_FAULTS,
+              PerfCounter::Value::Unit::COUNT},
+          {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, PerfCounter::Value::Unit::COUNT},
+          {"instructions",
+              PERF_TYPE_HARDWARE,
+              PERF_COUNT_HW_INSTRUCTIONS,
+              PerfCounter::Value::Unit::COUNT},
+          {"cache-misses",
+              PERF_TYPE_HARDWARE,
+              PERF_COUNT_HW_CACHE_MISSES,
+              PerfCounter::Value::Unit::COUNT}}};
+
+  close_events();
+
+  for (auto&& definition : definitions) {
+    int file_descriptor{open_event(definition, false)};
+
+    // A restrictive `perf_event_paranoid` setting still allows to count user space.
+    if (file_descriptor == -1 && (errno == EACCES || errno == EPERM)) {
+      file_descriptor = open_event(definition, true);
+    }
+
+    // Hardware counters are usually not available in containers and virtual machines.
+    if (file_descriptor == -1) {
+      LITR_CORE_TRACE("Performance counter \"{}\" is not available (errno {}).",
+          definition.name,
+          errno);
+      continue;
+    }
+
+    m_events.push_back({definition.name, file_descriptor, definition.unit});
+  }
+
+  for (auto&& event : m_events) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    ioctl(event.file_descriptor, PERF_EVENT_IOC_RESET, 0);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    ioctl(event.file_descriptor, PERF_EVENT_IOC_ENABLE, 0);
+  }
+}
+
+void PerfCounter::stop() {
+  LITR_PROFILE_FUNCTION();
+
+  for (auto&& event : m_events) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    ioctl(event.file_descriptor, PERF_EVENT_IOC_DISABLE, 0);
+  }
+}
+
+PerfCounter::Values PerfCounter::get_values() const {
+  LITR_PROFILE_FUNCTION();
+
+  Values values{};
+
+  for (auto&& event : m_events) {
+    struct {
+      uint64_t value;
+      uint64_t time_enabled;
+      uint64_t time_running;
+    } data{};
+
+    if (read(event.file_descriptor, &data, sizeof(data)) != sizeof(data) ||
+        data.time_running == 0) {
+      continue;
+    }
+
+    // Scale the result if the kernel had to multiplex the counters.
+    uint64_t count{data.value};
+    if (data.time_running < data.time_enabled) {
+      count = static_cast<uint64_t>(static_cast<double>(data.value) *
+                                    static_cast<double>(data.time_enabled) /
+                                    static_cast<double>(data.time_running));
+    }
+
+    values.push_back({event.name, count, event.unit});
+  }
+
+  return values;
+}
+
+void PerfCounter::close_events() {
+  for (auto&& event : m_events) {
+    close(event.file_descriptor);
+  }
+  m_events.clear();
+}
+
+}  // namespace Litr::Debug
@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <sys/ptrace.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <set>
+#include <thread>
+
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/Log.hpp"
+#include "Core/ProcessTracer.hpp"
+
+namespace Litr {
+
+/** @private */
+static constexpr std::chrono::milliseconds poll_interval{100};
+
+/** @private */
+struct PathArguments {
+  // Index of the directory descriptor a relative path starts from, if there is one.
+  std::optional<size_t> directory{};
+  size_t path{0};
+};
+
+/** @private */
+static std::optional<PathArguments> get_path_arguments(uint64_t syscall) {
+  switch (syscall) {
+#ifdef SYS_open
+    case SYS_open:
+#endif
+#ifdef SYS_creat
+    case SYS_creat:
+#endif
+#ifdef SYS_stat
+    case SYS_stat:
+#endif
+#ifdef SYS_lstat
+    case SYS_lstat:
+#endif
+#ifdef SYS_access
+    case SYS_access:
+#endif
+#ifdef SYS_readlink
+    case SYS_readlink:
+#endif
+    case SYS_execve: {
+      return PathArguments{std::nullopt, 0};
+    }
+#ifdef SYS_openat2
+    case SYS_openat2:
+#endif
+#ifdef SYS_newfstatat
+    case SYS_newfstatat:
+#endif
+#ifdef SYS_fstatat64
+    case SYS_fstatat64:
+#endif
+#ifdef SYS_statx
+    case SYS_statx:
+#endif
+#ifdef SYS_faccessat2
+    case SYS_faccessat2:
+#endif
+#ifdef SYS_execveat
+    case SYS_execveat:
+#endif
+    case SYS_openat:
+    case SYS_faccessat:
+    case SYS_readlinkat: {
+      return PathArguments{0, 1};
+    }
+    default: {
+      return std::nullopt;
+    }
+  }
+}
+
+/** @private */
+static std::string read_string(pid_t pid, uint64_t address) {
+  constexpr size_t max_length{PATH_MAX};
+  std::string value{};
+
+  // Paths are read a word at a time, they are mostly short.
+  while (value.size() < max_length) {
+    errno = 0;
+    const long word{ptrace(PTRACE_PEEKDATA, pid, address + value.size(), nullptr)};
+    if (errno != 0) {
+      return {};
+    }
+
+    std::array<char, sizeof(word)> bytes{};
+    std::memcpy(bytes.data(), &word, sizeof(word));
+    for (const char byte : bytes) {
+      if (byte == '\0') {
+        return value;
+      }
+      value.push_back(byte);
+    }
+  }
+
+  return {};
+}
+
+/** @private */
+static std::string read_link(const std::string& path) {
+  std::array<char, PATH_MAX> buffer{};
+  const ssize_t length{readlink(path.c_str(), buffer.data(), buffer.size())};
+  return length > 0 ? std::string(buffer.data(), static_cast<size_t>(length)) : "";
+}
+
+/** @private */
+static std::string resolve_path(pid_t pid, int directory, const std::string& path) {
+  if (path.empty()) {
+    return {};
+  }
+
+  std::string base{};
+  if (path.front() != '/') {
+    // The process is stopped, its working directory and descriptors are the ones it uses.
+    base = read_link(directory == AT_FDCWD ? fmt::format("/proc/{}/cwd", pid)
+                                           : fmt::format("/proc/{}/fd/{}", pid, directory));
+    if (base.empty()) {
+      return {};
+    }
+  }
+
+  std::string resolved{(std::filesystem::path{base} / path).lexically_normal().string()};
+  if (resolved.size() > 1 && resolved.back() == '/') {
+    resolved.pop_back();
+  }
+
+  return resolved;
+}
+
+/** @private */
+static bool is_virtual(const std::string& path) {
+  for (const std::string_view directory : {"/proc", "/dev", "/sys"}) {
+    if (path.compare(0, directory.size(), directory) == 0 &&
+        (path.size() == directory.size() || path[directory.size()] == '/')) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/** @private */
+static void record_syscall(pid_t pid, std::set<std::string>& files) {
+  __ptrace_syscall_info info{};
+  if (ptrace(PTRACE_GET_SYSCALL_INFO, pid, sizeof(info), &info) <= 0 ||
+      info.op != PTRACE_SYSCALL_INFO_ENTRY) {
+    return;
+  }
+
+  const std::optional<PathArguments> arguments{get_path_arguments(info.entry.nr)};
+  if (!arguments.has_value()) {
+    return;
+  }
+
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+  const int directory{arguments->directory.has_value()
+                          ? static_cast<int>(info.entry.args[*arguments->directory])
+                          : AT_FDCWD};
+  const std::string path{
+      resolve_path(pid, directory, read_string(pid, info.entry.args[arguments->path]))};
+  // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+
+  if (!path.empty() && !is_virtual(path)) {
+    files.insert(path);
+  }
+}
+
+/** @private */
+static void resume(pid_t pid, int signal) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+  ptrace(PTRACE_SYSCALL, pid, nullptr, reinterpret_cast<void*>(static_cast<intptr_t>(signal)));
+}
+
+bool ProcessTracer::is_supported() {
+  return true;
+}
+
+ProcessTracer::Result ProcessTracer::run(const std::string& command,
+    const Process::Limits& limits,
+    const Output& output,
+    const Process::CancelCheck& cancel_check) {
+  LITR_PROFILE_FUNCTION();
+
+  Result result{};
+  const bool is_grouped{limits.timeout.count() > 0 || cancel_check != nullptr};
+  std::array<int, 2> descriptors{};
+  if (pipe2(descriptors.data(), O_CLOEXEC) == -1) {
+    LITR_CORE_ERROR("Could not create pipe to trace command (errno {})", errno);
+    return result;
+  }
+
+  const auto [read_end, write_end] = descriptors;
+  const pid_t child{fork()};
+
+  if (child == 0) {
+    // Only async signal safe calls until the shell runs, other threads may hold locks.
+    dup2(write_end, STDOUT_FILENO);
+    dup2(write_end, STDERR_FILENO);
+
+    if (!Process::apply(limits, is_grouped)) {
+      _exit(126);  // NOLINT(readability-magic-numbers)
+    }
+
+    // Without a tracer the command still runs, it just does not tell anything.
+    if (ptrace(PTRACE_TRACEME, 0, nullptr, nullptr) == 0) {
+      raise(SIGSTOP);
+    }
+
+    execl("/bin/sh", "sh", "-c", command.c_str(), nullptr);
+    _exit(127);  // NOLINT(readability-magic-numbers)
+  }
+
+  close(write_end);
+  if (child == -1) {
+    LITR_CORE_ERROR("Could not start command to trace (errno {})", errno);
+    close(read_end);
+    return result;
+  }
+
+  // Traced processes stop for signals as well, they still end once the tracer passes
+  // the signal on to them.
+  std::optional<Process::Watchdog> watchdog{};
+  std::optional<Process::SignalRelay> relay{};
+  if (is_grouped) {
+    setpgid(child, child);
+    watchdog.emplace(child, limits.timeout);
+    relay.emplace(child);
+  }
+
+  // The cancel check is asked in between reading, this thread waits for the tracer meanwhile.
+  std::atomic<bool> is_cancelled{false};
+  std::thread reader{[read_end = read_end, &output, &cancel_check, &watchdog, &is_cancelled]() {
+    std::array<char, 256> buffer{};  // NOLINT(readability-magic-numbers)
+    pollfd readable{read_end, POLLIN, 0};
+    const int timeout{cancel_check ? static_cast<int>(poll_interval.count()) : -1};
+
+    while (true) {
+      if (cancel_check && !is_cancelled && cancel_check()) {
+        is_cancelled = true;
+        watchdog->end();
+      }
+
+      const int ready{poll(&readable, 1, timeout)};
+      if (ready == -1 && errno == EINTR) {
+        continue;
+      }
+      if (ready == -1) {
+        return;
+      }
+      if (ready == 0) {
+        continue;
+      }
+
+      const ssize_t length{read(read_end, buffer.data(), buffer.size())};
+      if (length == -1 && errno == EINTR) {
+        continue;
+      }
+      if (length <= 0) {
+        return;
+      }
+      output(std::string(buffer.data(), static_cast<size_t>(length)));
+    }
+  }};
+
+  // Processes are known from their first stop on, which may come before or after their
+  // parent tells about them. That first stop is not meant for the process itself.
+  std::set<pid_t> tracees{child};
+  std::set<pid_t> starting{};
+  std::set<pid_t> started{};
+  std::set<std::string> files{};
+  bool is_first_stop{true};
+
+  // Only processes of this thread are waited for, other threads run commands of their own.
+  while (!tracees.empty()) {
+    int status{0};
+    const pid_t pid{waitpid(-1, &status, __WALL | __WNOTHREAD)};
+
+    if (pid == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      break;
+    }
+
+    if (WIFEXITED(status) || WIFSIGNALED(status)) {
+      if (pid == child) {
+        constexpr int signal_base{128};
+        result.exit_code =
+            WIFEXITED(status) ? WEXITSTATUS(status) : signal_base + WTERMSIG(status);
+      }
+      tracees.erase(pid);
+      continue;
+    }
+
+    if (!WIFSTOPPED(status)) {
+      continue;
+    }
+
+    const int signal{WSTOPSIG(status)};
+    const int event{status >> 16};  // NOLINT(readability-magic-numbers)
+
+    if (pid == child && is_first_stop) {
+      is_first_stop = false;
+      ptrace(PTRACE_SETOPTIONS,
+          child,
+          nullptr,
+          PTRACE_O_TRACESYSGOOD | PTRACE_O_TRACEFORK | PTRACE_O_TRACEVFORK | PTRACE_O_TRACECLONE |
+              PTRACE_O_TRACEEXEC | PTRACE_O_EXITKILL);
+      resume(pid, 0);
+      continue;
+    }
+
+    if (signal == (SIGTRAP | 0x80)) {  // NOLINT(readability-magic-numbers)
+      record_syscall(pid, files);
+      resume(pid, 0);
+      continue;
+    }
+
+    if (event == PTRACE_EVENT_FORK || event == PTRACE_EVENT_VFORK ||
+        event == PTRACE_EVENT_CLONE) {
+      unsigned long new_pid{0};
+      ptrace(PTRACE_GETEVENTMSG, pid, nullptr, &new_pid);
+      const auto process{static_cast<pid_t>(new_pid)};
+      if (started.erase(process) == 0) {
+        tracees.insert(process);
+        starting.insert(process);
+      }
+    }
+
+    if (event != 0) {
+      resume(pid, 0);
+      continue;
+    }
+
+    if (signal == SIGSTOP && (starting.erase(pid) > 0 || tracees.count(pid) == 0)) {
+      if (tracees.insert(pid).second) {
+        started.insert(pid);
+      }
+      resume(pid, 0);
+      continue;
+    }
+
+    resume(pid, signal);
+  }
+
+  reader.join();
+  close(read_end);
+  result.cancelled = is_cancelled;
+  result.timed_out = watchdog.has_value() && watchdog->has_fired() && !result.cancelled;
+
+  result.files.assign(files.begin(), files.end());
+  LITR_CORE_TRACE("Traced {} files of \"{}\"", result.files.size(), command);
+
+  return result;
+}
+
+}  // namespace Litr
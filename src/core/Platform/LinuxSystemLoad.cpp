@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/SystemLoad.hpp"
+
+namespace Litr {
+
+/** @private */
+static std::optional<double> read_load_average() {
+  std::ifstream file{"/proc/loadavg"};
+  double load{0};
+  if (file >> load) {
+    return load;
+  }
+
+  return std::nullopt;
+}
+
+/** @private */
+static std::optional<double> read_pressure(const char* path) {
+  // The first line is the one of some tasks stalling, e.g. `some avg10=1.23 avg60=...`.
+  std::ifstream file{path};
+  std::string line{};
+  double pressure{0};
+  if (std::getline(file, line) && std::sscanf(line.c_str(), "some avg10=%lf", &pressure) == 1) {
+    return pressure;
+  }
+
+  return std::nullopt;
+}
+
+/** @private */
+static void read_memory(SystemLoad::Sample& sample) {
+  constexpr uint64_t bytes_per_kilobyte{1024};
+
+  std::ifstream file{"/proc/meminfo"};
+  std::string line{};
+  while (std::getline(file, line) &&
+         !(sample.memory_total.has_value() && sample.memory_available.has_value())) {
+    unsigned long long kilobytes{0};
+    if (std::sscanf(line.c_str(), "MemTotal: %llu kB", &kilobytes) == 1) {
+      sample.memory_total = kilobytes * bytes_per_kilobyte;
+    } else if (std::sscanf(line.c_str(), "MemAvailable: %llu kB", &kilobytes) == 1) {
+      sample.memory_available = kilobytes * bytes_per_kilobyte;
+    }
+  }
+}
+
+SystemLoad::Sample SystemLoad::read() {
+  LITR_PROFILE_FUNCTION();
+
+  Sample sample{};
+  sample.load_average = read_load_average();
+  sample.cpu_pressure = read_pressure("/proc/pressure/cpu");
+  sample.memory_pressure = read_pressure("/proc/pressure/memory");
+  sample.io_pressure = read_pressure("/proc/pressure/io");
+  read_memory(sample);
+
+  return sample;
+}
+
+}  // namespace Litr
@@ -36,4 +36,10 @@ Path Environment::get_home_directory() {
   return {};
 }
 
+Path Environment::get_cache_directory() {
+  LITR_PROFILE_FUNCTION();
+
+  return get_home_directory().append(std::string{"Library/Caches/litr"});
+}
+
 }  // namespace Litr
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+
+#include "Core/AppendFile.hpp"
+#include "Core/Debug/Instrumentor.hpp"
+
+namespace Litr {
+
+AppendFile::AppendFile(const Path& path, Mode mode) {
+  LITR_PROFILE_FUNCTION();
+
+  const int flags{O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC |
+                  (mode == Mode::TRUNCATE ? O_TRUNC : 0)};
+  constexpr mode_t permissions{0644};
+
+  m_file_descriptor = open(path.to_string().c_str(), flags, permissions);  // NOLINT
+}
+
+AppendFile::~AppendFile() {
+  if (m_file_descriptor != -1) {
+    close(m_file_descriptor);
+  }
+}
+
+bool AppendFile::append(std::string_view data) {
+  LITR_PROFILE_FUNCTION();
+
+  if (m_file_descriptor == -1) {
+    return false;
+  }
+
+  while (!data.empty()) {
+    const ssize_t written{write(m_file_descriptor, data.data(), data.size())};
+    if (written == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    data.remove_prefix(static_cast<size_t>(written));
+  }
+
+  return fsync(m_file_descriptor) == 0;
+}
+
+}  // namespace Litr
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include <sys/resource.h>
+
+#include "Core/Debug/CpuTime.hpp"
+#include "Core/Debug/Instrumentor.hpp"
+
+namespace Litr::Debug {
+
+/** @private */
+static std::chrono::microseconds to_microseconds(const timeval& time) {
+  return std::chrono::seconds(time.tv_sec) + std::chrono::microseconds(time.tv_usec);
+}
+
+CpuTime CpuTime::of_children() {
+  LITR_PROFILE_FUNCTION();
+
+  rusage usage{};
+  if (getrusage(RUSAGE_CHILDREN, &usage) != 0) {
+    return {};
+  }
+
+  return {to_microseconds(usage.ru_utime), to_microseconds(usage.ru_stime)};
+}
+
+}  // namespace Litr::Debug
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+
+#include <cerrno>
+
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/FileLock.hpp"
+
+namespace Litr {
+
+FileLock::FileLock(const Path& path) {
+  LITR_PROFILE_FUNCTION();
+
+  constexpr mode_t permissions{0644};
+  m_file_descriptor =
+      open(path.to_string().c_str(), O_RDWR | O_CREAT | O_CLOEXEC, permissions);  // NOLINT
+}
+
+FileLock::~FileLock() {
+  if (m_file_descriptor != -1) {
+    close(m_file_descriptor);
+  }
+}
+
+bool FileLock::try_lock() {
+  LITR_PROFILE_FUNCTION();
+
+  return m_file_descriptor != -1 && flock(m_file_descriptor, LOCK_EX | LOCK_NB) == 0;
+}
+
+bool FileLock::lock() {
+  LITR_PROFILE_FUNCTION();
+
+  if (m_file_descriptor == -1) {
+    return false;
+  }
+
+  while (flock(m_file_descriptor, LOCK_EX) == -1) {
+    if (errno != EINTR) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void FileLock::unlock() {
+  LITR_PROFILE_FUNCTION();
+
+  if (m_file_descriptor != -1) {
+    flock(m_file_descriptor, LOCK_UN);
+  }
+}
+
+}  // namespace Litr
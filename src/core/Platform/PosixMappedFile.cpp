@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/MappedFile.hpp"
+
+namespace Litr {
+
+MappedFile::MappedFile(const Path& path) {
+  LITR_PROFILE_FUNCTION();
+
+  const int file_descriptor{open(path.to_string().c_str(), O_RDONLY)};  // NOLINT
+  if (file_descriptor == -1) {
+    return;
+  }
+
+  struct stat status {};
+  if (fstat(file_descriptor, &status) != 0 || !S_ISREG(status.st_mode)) {  // NOLINT
+    close(file_descriptor);
+    return;
+  }
+
+  m_open = true;
+  m_size = static_cast<size_t>(status.st_size);
+
+  // An empty file cannot be mapped, but is still a valid file.
+  if (m_size > 0) {
+    void* data{mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0)};
+    if (data == MAP_FAILED) {  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+      m_open = false;
+      m_size = 0;
+    } else {
+      madvise(data, m_size, MADV_SEQUENTIAL);
+      m_data = static_cast<const char*>(data);
+      m_mapped = true;
+    }
+  }
+
+  // The mapping stays valid after the file is closed.
+  close(file_descriptor);
+}
+
+MappedFile::~MappedFile() {
+  if (m_mapped) {
+    munmap(const_cast<char*>(m_data), m_size);  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+  }
+}
+
+}  // namespace Litr
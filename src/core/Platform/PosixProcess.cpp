@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <mutex>
+#include <optional>
+
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/Log.hpp"
+#include "Core/Process.hpp"
+
+namespace Litr {
+
+/** @private */
+static constexpr std::chrono::seconds termination_grace{5};
+// Time left for descendants outside of an ended group to close the output.
+/** @private */
+static constexpr std::chrono::seconds output_grace{1};
+/** @private */
+static constexpr std::chrono::milliseconds poll_interval{100};
+
+/** @private */
+static constexpr std::array<int, 3> relayed_signals{SIGINT, SIGTERM, SIGHUP};
+// Process groups signals are passed on to, a free place is zero. Lock free, so the
+// signal handler can read it.
+/** @private */
+static std::array<std::atomic<pid_t>, 64> relayed_groups{};  // NOLINT(readability-magic-numbers)
+
+/** @private */
+static void relay_signal(int signal) {
+  for (auto&& group : relayed_groups) {
+    const pid_t process_group{group.load()};
+    if (process_group > 0) {
+      kill(-process_group, signal);
+    }
+  }
+
+  // Litr itself ends the same way it would without passing the signal on.
+  struct sigaction action {};
+  action.sa_handler = SIG_DFL;
+  sigemptyset(&action.sa_mask);
+  sigaction(signal, &action, nullptr);
+  raise(signal);
+}
+
+/** @private */
+static void install_signal_relay() {
+  for (const int signal : relayed_signals) {
+    // Signals ignored or handled already, e.g. hangups with nohup, are left as they are.
+    struct sigaction current {};
+    if (sigaction(signal, nullptr, &current) == -1 || current.sa_handler != SIG_DFL) {
+      continue;
+    }
+
+    struct sigaction action {};
+    action.sa_handler = relay_signal;
+    sigemptyset(&action.sa_mask);
+    sigaction(signal, &action, nullptr);
+  }
+}
+
+// Processes start one after another, none may inherit the pipe of another one before it
+// is closed on `exec`. Only Linux creates it like that right away.
+/** @private */
+static std::mutex start_mutex{};
+
+/** @private */
+static bool create_pipe(std::array<int, 2>& descriptors) {
+#ifdef __linux__
+  return pipe2(descriptors.data(), O_CLOEXEC) == 0;
+#else
+  return pipe(descriptors.data()) == 0 && fcntl(descriptors[0], F_SETFD, FD_CLOEXEC) != -1 &&
+         fcntl(descriptors[1], F_SETFD, FD_CLOEXEC) != -1;
+#endif
+}
+
+/** @private */
+static bool set_limit(int resource, rlim_t value) {
+  // Only the soft limit is set, the hard one is only raised if it is below.
+  rlimit limit{};
+  if (getrlimit(resource, &limit) == -1) {
+    return false;
+  }
+
+  limit.rlim_cur = value;
+  if (limit.rlim_max != RLIM_INFINITY && limit.rlim_max < limit.rlim_cur) {
+    limit.rlim_max = limit.rlim_cur;
+  }
+
+  return setrlimit(resource, &limit) == 0;
+}
+
+/** @private */
+static bool has_exited(pid_t process) {
+  // Not waited for yet, the exit code is still needed afterwards.
+  siginfo_t info{};
+  return waitid(P_PID, static_cast<id_t>(process), &info, WEXITED | WNOHANG | WNOWAIT) == 0 &&
+         info.si_pid == process;
+}
+
+/** @private */
+static void write_error(const char* message) {
+  // Nothing but `write` is safe to use before the shell runs.
+  [[maybe_unused]] const ssize_t written{write(STDERR_FILENO, message, std::strlen(message))};
+}
+
+Process::Watchdog::Watchdog(int process_group, std::chrono::seconds timeout)
+    : m_thread([this, process_group, timeout]() { watch(process_group, timeout); }) {}
+
+Process::Watchdog::~Watchdog() {
+  {
+    std::lock_guard lock{m_mutex};
+    m_is_stopped = true;
+  }
+
+  m_stopped.notify_all();
+  m_thread.join();
+}
+
+bool Process::Watchdog::has_fired() const {
+  return m_has_fired;
+}
+
+void Process::Watchdog::end() {
+  {
+    std::lock_guard lock{m_mutex};
+    m_is_ending = true;
+  }
+
+  m_stopped.notify_all();
+}
+
+void Process::Watchdog::watch(int process_group, std::chrono::seconds timeout) {
+  LITR_PROFILE_FUNCTION();
+
+  const auto is_stopped{[this]() { return m_is_stopped; }};
+  const auto is_due{[this]() { return m_is_stopped || m_is_ending; }};
+  std::unique_lock lock{m_mutex};
+
+  if (timeout.count() > 0) {
+    m_stopped.wait_for(lock, timeout, is_due);
+  } else {
+    m_stopped.wait(lock, is_due);
+  }
+  if (m_is_stopped) {
+    return;
+  }
+
+  LITR_CORE_TRACE("Terminating process group {}", process_group);
+  m_has_fired = true;
+  kill(-process_group, SIGTERM);
+
+  if (m_stopped.wait_for(lock, termination_grace, is_stopped)) {
+    return;
+  }
+
+  LITR_CORE_TRACE("Killing process group {}", process_group);
+  kill(-process_group, SIGKILL);
+}
+
+Process::SignalRelay::SignalRelay(int process_group) {
+  static std::once_flag installed{};
+  std::call_once(installed, install_signal_relay);
+
+  for (size_t index{0}; index < relayed_groups.size(); ++index) {
+    pid_t free{0};
+    if (relayed_groups[index].compare_exchange_strong(free, process_group)) {
+      m_index = index;
+      return;
+    }
+  }
+
+  LITR_CORE_TRACE("Signals are not passed on to process group {}, too many", process_group);
+}
+
+Process::SignalRelay::~SignalRelay() {
+  if (m_index.has_value()) {
+    relayed_groups[*m_index] = 0;
+  }
+}
+
+bool Process::is_supported() {
+  return true;
+}
+
+Process::Result Process::run(const std::string& command,
+    const Limits& limits,
+    const Output& output,
+    const CancelCheck& cancel_check) {
+  LITR_PROFILE_FUNCTION();
+
+  Result result{};
+  const bool is_grouped{limits.timeout.count() > 0 || cancel_check != nullptr};
+  std::array<int, 2> descriptors{};
+  std::unique_lock starting{start_mutex};
+  if (!create_pipe(descriptors)) {
+    LITR_CORE_ERROR("Could not create pipe to run command (errno {})", errno);
+    return result;
+  }
+
+  const auto [read_end, write_end] = descriptors;
+  const pid_t child{fork()};
+
+  if (child == 0) {
+    // Only async signal safe calls until the shell runs, other threads may hold locks.
+    dup2(write_end, STDOUT_FILENO);
+    dup2(write_end, STDERR_FILENO);
+
+    if (!apply(limits, is_grouped)) {
+      _exit(126);  // NOLINT(readability-magic-numbers)
+    }
+
+    execl("/bin/sh", "sh", "-c", command.c_str(), nullptr);
+    _exit(127);  // NOLINT(readability-magic-numbers)
+  }
+
+  starting.unlock();
+  close(write_end);
+  if (child == -1) {
+    LITR_CORE_ERROR("Could not start command (errno {})", errno);
+    close(read_end);
+    return result;
+  }
+
+  // Both sides create the group, the watchdog must not end anything before it exists.
+  std::optional<Watchdog> watchdog{};
+  std::optional<SignalRelay> relay{};
+  if (is_grouped) {
+    setpgid(child, child);
+    watchdog.emplace(child, limits.timeout);
+    relay.emplace(child);
+  }
+
+  result.cancelled = read_output(
+      read_end, child, watchdog.has_value() ? &*watchdog : nullptr, output, cancel_check);
+  close(read_end);
+
+  int status{0};
+  while (waitpid(child, &status, 0) == -1) {
+    if (errno != EINTR) {
+      return result;
+    }
+  }
+
+  constexpr int signal_base{128};
+  result.exit_code = WIFEXITED(status) ? WEXITSTATUS(status) : signal_base + WTERMSIG(status);
+  result.timed_out = watchdog.has_value() && watchdog->has_fired() && !result.cancelled;
+
+  return result;
+}
+
+bool Process::read_output(int descriptor,
+    int process,
+    Watchdog* watchdog,
+    const Output& output,
+    const CancelCheck& cancel_check) {
+  LITR_PROFILE_FUNCTION();
+
+  using Clock = std::chrono::steady_clock;
+
+  // Descendants leaving the process group keep the output open, even once the watchdog
+  // ended the group. What they write is only read for a while after that.
+  std::optional<Clock::time_point> deadline{};
+  std::array<char, 256> buffer{};  // NOLINT(readability-magic-numbers)
+  pollfd readable{descriptor, POLLIN, 0};
+  bool is_cancelled{false};
+
+  while (true) {
+    if (watchdog != nullptr && cancel_check && !is_cancelled && cancel_check()) {
+      LITR_CORE_TRACE("Cancelling process group {}", process);
+      is_cancelled = true;
+      watchdog->end();
+    }
+    if (watchdog != nullptr && watchdog->has_fired() && !deadline.has_value() &&
+        has_exited(process)) {
+      deadline = Clock::now() + output_grace;
+    }
+    if (deadline.has_value() && Clock::now() >= *deadline) {
+      break;
+    }
+
+    // Without a watchdog nothing can end the command, waiting for output is all there is.
+    const int timeout{watchdog != nullptr ? static_cast<int>(poll_interval.count()) : -1};
+    const int ready{poll(&readable, 1, timeout)};
+    if (ready == -1 && errno == EINTR) {
+      continue;
+    }
+    if (ready == -1) {
+      break;
+    }
+    if (ready == 0) {
+      continue;
+    }
+
+    const ssize_t length{read(descriptor, buffer.data(), buffer.size())};
+    if (length == -1 && errno == EINTR) {
+      continue;
+    }
+    if (length <= 0) {
+      break;
+    }
+    output(std::string(buffer.data(), static_cast<size_t>(length)));
+  }
+
+  return is_cancelled;
+}
+
+bool Process::apply(const Limits& limits, bool is_grouped) {
+  const bool has_group{is_grouped || limits.timeout.count() > 0};
+  if (has_group && setpgid(0, 0) == -1) {
+    write_error("litr: Could not start a process group for the command.\n");
+    return false;
+  }
+
+  // A group of its own is stopped once it reads from the terminal, it reads nothing instead.
+  termios terminal{};
+  if (has_group && tcgetattr(STDIN_FILENO, &terminal) == 0) {
+    const int nothing{open("/dev/null", O_RDONLY)};
+    if (nothing == -1 || dup2(nothing, STDIN_FILENO) == -1) {
+      write_error("litr: Could not detach the command from the terminal.\n");
+      return false;
+    }
+    close(nothing);
+  }
+
+  if (limits.nice.has_value() && setpriority(PRIO_PROCESS, 0, *limits.nice) == -1) {
+    write_error("litr: Could not change the niceness of the command.\n");
+    return false;
+  }
+
+#ifdef __linux__
+  if (!limits.cpus.empty()) {
+    cpu_set_t cpus{};
+    CPU_ZERO(&cpus);
+    for (const size_t cpu : limits.cpus) {
+      CPU_SET(cpu, &cpus);
+    }
+
+    if (sched_setaffinity(0, sizeof(cpus), &cpus) == -1) {
+      write_error("litr: Could not bind the command to the given CPUs.\n");
+      return false;
+    }
+  }
+#endif
+
+  if (limits.memory.has_value() && !set_limit(RLIMIT_AS, *limits.memory)) {
+    write_error("litr: Could not limit the memory of the command.\n");
+    return false;
+  }
+
+  if (limits.open_files.has_value() && !set_limit(RLIMIT_NOFILE, *limits.open_files)) {
+    write_error("litr: Could not limit the open files of the command.\n");
+    return false;
+  }
+
+  return true;
+}
+
+}  // namespace Litr
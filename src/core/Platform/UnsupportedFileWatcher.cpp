@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/FileWatcher.hpp"
+
+namespace Litr {
+
+// There is no inotify outside of Linux, so nothing is watched and no changes are
+// ever reported.
+
+FileWatcher::FileWatcher() = default;
+
+FileWatcher::~FileWatcher() = default;
+
+bool FileWatcher::is_supported() {
+  return false;
+}
+
+void FileWatcher::add_directory(const Path& /*directory*/) {}
+
+FileWatcher::Files FileWatcher::wait(std::chrono::milliseconds /*quiet_period*/) {
+  return {};
+}
+
+bool FileWatcher::has_changes() {
+  return false;
+}
+
+void FileWatcher::watch_tree(const std::string& /*directory*/, size_t /*root*/) {}
+
+void FileWatcher::watch(const std::string& /*directory*/, size_t /*root*/) {}
+
+void FileWatcher::read_changes() {}
+
+bool FileWatcher::is_ignored(const Directory& /*directory*/,
+    const std::string& /*name*/,
+    bool /*is_directory*/) const {
+  return false;
+}
+
+}  // namespace Litr
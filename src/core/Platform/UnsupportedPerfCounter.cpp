@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/Debug/PerfCounter.hpp"
+
+namespace Litr::Debug {
+
+// There are no performance counters without Linux `perf_event_open`, so
+// nothing is counted and no values are reported.
+
+PerfCounter::~PerfCounter() = default;
+
+void PerfCounter::start() {}
+
+void PerfCounter::stop() {}
+
+PerfCounter::Values PerfCounter::get_values() const {
+  return {};
+}
+
+void PerfCounter::close_events() {}
+
+}  // namespace Litr::Debug
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/Process.hpp"
+
+namespace Litr {
+
+// Commands run through the shell as they always did, without any limits or timeouts.
+
+bool Process::is_supported() {
+  return false;
+}
+
+Process::Result Process::run(const std::string& /*command*/,
+    const Limits& /*limits*/,
+    const Output& /*output*/,
+    const CancelCheck& /*cancel_check*/) {
+  return {};
+}
+
+bool Process::apply(const Limits& /*limits*/, bool /*is_grouped*/) {
+  return true;
+}
+
+}  // namespace Litr
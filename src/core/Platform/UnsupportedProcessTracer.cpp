@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/ProcessTracer.hpp"
+
+namespace Litr {
+
+// There is no ptrace outside of Linux, nothing runs traced and no files are ever found.
+
+bool ProcessTracer::is_supported() {
+  return false;
+}
+
+ProcessTracer::Result ProcessTracer::run(const std::string& /*command*/,
+    const Process::Limits& /*limits*/,
+    const Output& /*output*/,
+    const Process::CancelCheck& /*cancel_check*/) {
+  return {};
+}
+
+}  // namespace Litr
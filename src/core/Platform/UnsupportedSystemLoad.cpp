@@ -0,0 +1,15 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/SystemLoad.hpp"
+
+namespace Litr {
+
+// Without `/proc` nothing is known, the load is never a reason to run less.
+
+SystemLoad::Sample SystemLoad::read() {
+  return {};
+}
+
+}  // namespace Litr
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+
+#include "Core/AppendFile.hpp"
+#include "Core/Debug/Instrumentor.hpp"
+
+namespace Litr {
+
+AppendFile::AppendFile(const Path& path, Mode mode) {
+  LITR_PROFILE_FUNCTION();
+
+  const int flags{_O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY | _O_NOINHERIT |
+                  (mode == Mode::TRUNCATE ? _O_TRUNC : 0)};
+
+  m_file_descriptor = _open(path.to_string().c_str(), flags, _S_IREAD | _S_IWRITE);
+}
+
+AppendFile::~AppendFile() {
+  if (m_file_descriptor != -1) {
+    _close(m_file_descriptor);
+  }
+}
+
+bool AppendFile::append(std::string_view data) {
+  LITR_PROFILE_FUNCTION();
+
+  if (m_file_descriptor == -1) {
+    return false;
+  }
+
+  while (!data.empty()) {
+    const int written{_write(m_file_descriptor, data.data(), static_cast<unsigned>(data.size()))};
+    if (written <= 0) {
+      return false;
+    }
+    data.remove_prefix(static_cast<size_t>(written));
+  }
+
+  return _commit(m_file_descriptor) == 0;
+}
+
+}  // namespace Litr
@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/Debug/CpuTime.hpp"
+
+namespace Litr::Debug {
+
+// Child process times are not collected on Windows, yet.
+CpuTime CpuTime::of_children() {
+  return {};
+}
+
+}  // namespace Litr::Debug
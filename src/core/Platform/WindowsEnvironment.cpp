@@ -17,4 +17,17 @@ Path Environment::get_home_directory() {
   return Path(std::getenv("HOMEPATH"));
 }
 
+Path Environment::get_cache_directory() {
+  LITR_PROFILE_FUNCTION();
+
+  // std::getenv is not thread safe, but this will not be a problem here.
+  // NOLINTNEXTLINE(concurrency-mt-unsafe)
+  const char* local_app_data{std::getenv("LOCALAPPDATA")};
+  if (local_app_data != nullptr && *local_app_data != '\0') {
+    return Path(local_app_data).append(std::string{"litr"});
+  }
+
+  return get_home_directory().append(std::string{"litr"});
+}
+
 }  // namespace Litr
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#include <windows.h>
+
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/FileLock.hpp"
+
+namespace Litr {
+
+/** @private */
+static bool lock_file(int file_descriptor, DWORD flags) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+  const auto handle{reinterpret_cast<HANDLE>(_get_osfhandle(file_descriptor))};
+  OVERLAPPED overlapped{};
+  return LockFileEx(handle, flags, 0, 1, 0, &overlapped) != 0;
+}
+
+FileLock::FileLock(const Path& path) {
+  LITR_PROFILE_FUNCTION();
+
+  m_file_descriptor = _open(path.to_string().c_str(),
+      _O_RDWR | _O_CREAT | _O_BINARY | _O_NOINHERIT,
+      _S_IREAD | _S_IWRITE);
+}
+
+FileLock::~FileLock() {
+  if (m_file_descriptor != -1) {
+    _close(m_file_descriptor);
+  }
+}
+
+bool FileLock::try_lock() {
+  LITR_PROFILE_FUNCTION();
+
+  return m_file_descriptor != -1 &&
+         lock_file(m_file_descriptor, LOCKFILE_EXCLUSIVE_LOCK | LOCKFILE_FAIL_IMMEDIATELY);
+}
+
+bool FileLock::lock() {
+  LITR_PROFILE_FUNCTION();
+
+  return m_file_descriptor != -1 && lock_file(m_file_descriptor, LOCKFILE_EXCLUSIVE_LOCK);
+}
+
+void FileLock::unlock() {
+  LITR_PROFILE_FUNCTION();
+
+  if (m_file_descriptor != -1) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+    const auto handle{reinterpret_cast<HANDLE>(_get_osfhandle(m_file_descriptor))};
+    OVERLAPPED overlapped{};
+    UnlockFileEx(handle, 0, 1, 0, &overlapped);
+  }
+}
+
+}  // namespace Litr
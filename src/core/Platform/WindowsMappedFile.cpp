@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include <fstream>
+#include <iterator>
+
+#include "Core/Debug/Instrumentor.hpp"
+#include "Core/MappedFile.hpp"
+
+namespace Litr {
+
+// Files are not mapped on Windows, yet. The contents are read once instead.
+MappedFile::MappedFile(const Path& path) {
+  LITR_PROFILE_FUNCTION();
+
+  std::ifstream file{path.to_string(), std::ios::binary};
+  if (!file.is_open()) {
+    return;
+  }
+
+  m_buffer.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+  m_data = m_buffer.data();
+  m_size = m_buffer.size();
+  m_open = true;
+}
+
+MappedFile::~MappedFile() = default;
+
+}  // namespace Litr
@@ -5,9 +5,8 @@
 #include "TOML.hpp"
 
 #include <fmt/format.h>
-#include <tsl/ordered_map.h>
 
-#include <toml.hpp>
+#include "Core/Config/MappedFileAdapter.hpp"
 
 TomlMock create_toml_mock(const std::string& name, const std::string& toml) {
   std::string r_context{fmt::format(R"([{}]
@@ -15,14 +14,10 @@ TomlMock create_toml_mock(const std::string& name, const std::string& toml) {
       name,
       toml)};
 
-  Litr::Config::TomlFileAdapter file{};
+  const Litr::Config::MappedFileAdapter file{};
 
-  std::istringstream is_context(r_context, std::ios_base::binary | std::ios_base::in);
-  const auto context =
-      toml::parse<toml::discard_comments, tsl::ordered_map>(is_context, "std::string");
-
-  std::istringstream is_data(toml, std::ios_base::binary | std::ios_base::in);
-  const auto data = toml::parse<toml::discard_comments, tsl::ordered_map>(is_data, "std::string");
+  const auto context{file.parse_source(r_context)};
+  const auto data{file.parse_source(toml)};
 
   return {context, data};
 }
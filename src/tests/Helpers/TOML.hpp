@@ -6,11 +6,11 @@
 
 #include <string>
 
-#include "Core/Config/TomlFileAdapter.hpp"
+#include "Core/Config/Value.hpp"
 
 struct TomlMock {
-  Litr::Config::TomlFileAdapter::Value context;
-  Litr::Config::TomlFileAdapter::Value data;
+  Litr::Config::Value context;
+  Litr::Config::Value data;
 };
 
 TomlMock create_toml_mock(const std::string& name, const std::string& toml);
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/AppendFile.hpp"
+
+#include <doctest/doctest.h>
+
+#include <filesystem>
+
+#include "Core/MappedFile.hpp"
+
+TEST_SUITE("AppendFile") {
+  TEST_CASE("Appends to the end of a file") {
+    const Litr::Path path{(std::filesystem::temp_directory_path() / "litr-append").string()};
+    std::filesystem::remove(path.to_string());
+
+    {
+      Litr::AppendFile file{path};
+      REQUIRE(file.is_open());
+      CHECK(file.append("one\n"));
+    }
+    {
+      Litr::AppendFile file{path};
+      CHECK(file.append("two\n"));
+    }
+
+    CHECK_EQ(Litr::MappedFile{path}.get_contents(), "one\ntwo\n");
+    std::filesystem::remove(path.to_string());
+  }
+
+  TEST_CASE("Starts over when truncating") {
+    const Litr::Path path{(std::filesystem::temp_directory_path() / "litr-truncate").string()};
+
+    {
+      Litr::AppendFile file{path};
+      CHECK(file.append("old\n"));
+    }
+    {
+      Litr::AppendFile file{path, Litr::AppendFile::Mode::TRUNCATE};
+      CHECK(file.append("new\n"));
+    }
+
+    CHECK_EQ(Litr::MappedFile{path}.get_contents(), "new\n");
+    std::filesystem::remove(path.to_string());
+  }
+
+  TEST_CASE("Cannot append to a file in a missing directory") {
+    Litr::AppendFile file{Litr::Path{"../../Fixtures/missing/journal"}};
+
+    CHECK_FALSE(file.is_open());
+    CHECK_FALSE(file.append("lost\n"));
+  }
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/Arena.hpp"
+
+#include <doctest/doctest.h>
+
+TEST_SUITE("Arena") {
+  TEST_CASE("allocate") {
+    SUBCASE("Returns blocks of the requested size") {
+      Litr::Arena<int> arena{4};
+
+      const Litr::Span<int> first{arena.allocate(3)};
+      const Litr::Span<int> second{arena.allocate(3)};
+
+      CHECK_EQ(first.size(), 3U);
+      CHECK_EQ(second.size(), 3U);
+      CHECK_NE(first.data(), second.data());
+    }
+
+    SUBCASE("Does not move values when growing") {
+      Litr::Arena<int> arena{2};
+
+      const Litr::Span<int> first{arena.allocate(2)};
+      first[0] = 1;
+      first[1] = 2;
+      static_cast<void>(arena.allocate(10));
+
+      CHECK_EQ(first[0], 1);
+      CHECK_EQ(first[1], 2);
+    }
+  }
+
+  TEST_CASE("append") {
+    SUBCASE("Grows a range in place") {
+      Litr::Arena<int> arena{8};
+
+      Litr::Span<const int> range{};
+      range = arena.append(range, 1);
+      const int* data{range.data()};
+      range = arena.append(range, 2);
+      range = arena.append(range, 3);
+
+      CHECK_EQ(range.size(), 3U);
+      CHECK_EQ(range.data(), data);
+      CHECK_EQ(range[0], 1);
+      CHECK_EQ(range[2], 3);
+    }
+
+    SUBCASE("Keeps ranges contiguous if appends interleave") {
+      Litr::Arena<int> arena{4};
+
+      Litr::Span<const int> first{};
+      Litr::Span<const int> second{};
+      for (int value{0}; value < 10; ++value) {
+        first = arena.append(first, value);
+        second = arena.append(second, value * 10);
+      }
+
+      CHECK_EQ(first.size(), 10U);
+      CHECK_EQ(second.size(), 10U);
+      for (int value{0}; value < 10; ++value) {
+        CHECK_EQ(first[static_cast<size_t>(value)], value);
+        CHECK_EQ(second[static_cast<size_t>(value)], value * 10);
+      }
+    }
+  }
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/CLI/Benchmark.hpp"
+
+#include <doctest/doctest.h>
+
+#include <vector>
+
+TEST_SUITE("CLI::Benchmark") {
+  using Seconds = Litr::CLI::Benchmark::Seconds;
+
+  TEST_CASE("Calculates statistics of samples") {
+    const auto statistics{Litr::CLI::Benchmark::get_statistics(
+        {Seconds{4.0}, Seconds{2.0}, Seconds{5.0}, Seconds{3.0}, Seconds{1.0}})};
+
+    CHECK_EQ(statistics.mean.count(), doctest::Approx(3.0));
+    CHECK_EQ(statistics.median.count(), doctest::Approx(3.0));
+    CHECK_EQ(statistics.min.count(), doctest::Approx(1.0));
+    CHECK_EQ(statistics.max.count(), doctest::Approx(5.0));
+    CHECK_EQ(statistics.standard_deviation.count(), doctest::Approx(1.5811).epsilon(0.001));
+    CHECK_EQ(statistics.outliers, 0U);
+  }
+
+  TEST_CASE("Detects outliers") {
+    const auto statistics{Litr::CLI::Benchmark::get_statistics({Seconds{1.0},
+        Seconds{1.1},
+        Seconds{0.9},
+        Seconds{1.0},
+        Seconds{1.05},
+        Seconds{0.95},
+        Seconds{9.0}})};
+
+    CHECK_EQ(statistics.outliers, 1U);
+    CHECK_EQ(statistics.median.count(), doctest::Approx(1.0));
+  }
+
+  TEST_CASE("Has no deviation for a single sample") {
+    const auto statistics{Litr::CLI::Benchmark::get_statistics({Seconds{2.0}})};
+
+    CHECK_EQ(statistics.mean.count(), doctest::Approx(2.0));
+    CHECK_EQ(statistics.standard_deviation.count(), doctest::Approx(0.0));
+    CHECK_EQ(statistics.outliers, 0U);
+  }
+
+  TEST_CASE("Handles no samples") {
+    const auto statistics{Litr::CLI::Benchmark::get_statistics({})};
+
+    CHECK_EQ(statistics.mean.count(), doctest::Approx(0.0));
+    CHECK_EQ(statistics.outliers, 0U);
+  }
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/CLI/Changes.hpp"
+
+#include <doctest/doctest.h>
+
+TEST_SUITE("CLI::Changes") {
+  TEST_CASE("Accepts git references") {
+    CHECK(Litr::CLI::Changes::is_valid_reference("HEAD"));
+    CHECK(Litr::CLI::Changes::is_valid_reference("HEAD~2"));
+    CHECK(Litr::CLI::Changes::is_valid_reference("origin/main"));
+    CHECK(Litr::CLI::Changes::is_valid_reference("main@{1}"));
+    CHECK(Litr::CLI::Changes::is_valid_reference("v1.2.0"));
+    CHECK(Litr::CLI::Changes::is_valid_reference("3f2c9a1"));
+  }
+
+  TEST_CASE("Rejects references that are no git references") {
+    CHECK_FALSE(Litr::CLI::Changes::is_valid_reference(""));
+    CHECK_FALSE(Litr::CLI::Changes::is_valid_reference("--output=file"));
+    CHECK_FALSE(Litr::CLI::Changes::is_valid_reference("main; rm -rf ."));
+    CHECK_FALSE(Litr::CLI::Changes::is_valid_reference("$(whoami)"));
+  }
+
+  TEST_CASE("Reports an invalid reference without asking git") {
+    const auto changes{Litr::CLI::Changes::of("main && exit 1")};
+
+    CHECK_EQ(changes->get_error(), R"("main && exit 1" is not a valid git reference.)");
+    CHECK(changes->get_files().empty());
+    CHECK_FALSE(changes->contains("."));
+  }
+
+  TEST_CASE("Finds directories and patterns of known files") {
+    const auto changes{Litr::CLI::Changes::from_files(
+        {"/litr-changes/packages/api/src/main.cpp", "/litr-changes/shared/config.h"})};
+
+    CHECK(changes->get_error().empty());
+    CHECK(changes->contains("/litr-changes/packages/api"));
+    CHECK(changes->contains("/litr-changes/packages/api/"));
+    CHECK_FALSE(changes->contains("/litr-changes/packages/web"));
+    CHECK_FALSE(changes->contains("/litr-changes/packages/ap"));
+    CHECK(changes->matches("/litr-changes/shared"));
+    CHECK(changes->matches("/litr-changes/**/*.cpp"));
+    CHECK_FALSE(changes->matches("/litr-changes/packages/web"));
+  }
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/CLI/CommandLock.hpp"
+
+#include <doctest/doctest.h>
+
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+TEST_SUITE("CLI::CommandLock") {
+  const Litr::Path directory{(std::filesystem::temp_directory_path() / "litr-locks").string()};
+
+  TEST_CASE("Reuses the result of the run waited for") {
+    std::filesystem::remove_all(directory.to_string());
+
+    auto first{std::make_unique<Litr::CLI::CommandLock>(
+        directory, "build", "", std::vector<std::string>{"make"})};
+    Litr::CLI::CommandLock second{directory, "build", "", {"make"}};
+    Litr::CLI::CommandLock other{directory, "test", "", {"make"}};
+
+    REQUIRE(first->try_lock());
+    CHECK_FALSE(second.try_lock());
+    CHECK(other.try_lock());
+
+    first->set_result({Litr::ExitStatus::SUCCESS, "built\n"});
+    first.reset();
+
+    const std::optional<Litr::CLI::Shell::Result> result{second.wait()};
+    REQUIRE(result.has_value());
+    CHECK_EQ(result->status, Litr::ExitStatus::SUCCESS);
+    CHECK_EQ(result->message, "built\n");
+
+    std::filesystem::remove_all(directory.to_string());
+  }
+
+  TEST_CASE("Runs again if the scripts are different") {
+    std::filesystem::remove_all(directory.to_string());
+
+    auto first{std::make_unique<Litr::CLI::CommandLock>(
+        directory, "build", "", std::vector<std::string>{"make debug"})};
+    Litr::CLI::CommandLock second{directory, "build", "", {"make release"}};
+
+    REQUIRE(first->try_lock());
+    CHECK_FALSE(second.try_lock());
+
+    first->set_result({Litr::ExitStatus::SUCCESS, "built\n"});
+    first.reset();
+
+    CHECK_FALSE(second.wait().has_value());
+
+    std::filesystem::remove_all(directory.to_string());
+  }
+
+  TEST_CASE("Leaves no result if nobody waits") {
+    std::filesystem::remove_all(directory.to_string());
+
+    {
+      Litr::CLI::CommandLock lock{directory, "build", "", {"make"}};
+      REQUIRE(lock.try_lock());
+      lock.set_result({Litr::ExitStatus::SUCCESS, "built\n"});
+    }
+
+    for (auto&& entry : std::filesystem::directory_iterator{directory.to_string()}) {
+      CHECK_NE(entry.path().extension(), ".result");
+    }
+
+    std::filesystem::remove_all(directory.to_string());
+  }
+
+  TEST_CASE("Commands without a directory lock the current one") {
+    std::filesystem::remove_all(directory.to_string());
+    const std::filesystem::path current{std::filesystem::current_path()};
+    const std::filesystem::path checkout{
+        std::filesystem::temp_directory_path() / "litr-locks-checkout"};
+    std::filesystem::create_directories(checkout);
+
+    Litr::CLI::CommandLock first{directory, "build", "", {"make"}};
+    REQUIRE(first.try_lock());
+
+    std::filesystem::current_path(checkout);
+    Litr::CLI::CommandLock second{directory, "build", "", {"make"}};
+    CHECK(second.try_lock());
+
+    std::filesystem::current_path(current);
+    std::filesystem::remove_all(checkout);
+    std::filesystem::remove_all(directory.to_string());
+  }
+}
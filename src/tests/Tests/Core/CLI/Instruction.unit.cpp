@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/CLI/Instruction.hpp"
+
+#include <doctest/doctest.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+TEST_SUITE("CLI::Instruction") {
+  TEST_CASE("Operands") {
+    SUBCASE("Small operands take a single byte") {
+      Litr::CLI::Instruction instruction{};
+      instruction.write_operand(127);
+
+      size_t offset{0};
+      CHECK_EQ(instruction.count(), 1U);
+      CHECK_EQ(instruction.read_operand(offset), 127U);
+      CHECK_EQ(offset, 1U);
+    }
+
+    SUBCASE("Large operands are read back unchanged") {
+      const std::array<size_t, 6> operands{0, 128, 255, 256, 16384, 4294967296};
+      Litr::CLI::Instruction instruction{};
+      for (auto&& operand : operands) {
+        instruction.write_operand(operand);
+      }
+
+      size_t offset{0};
+      for (auto&& operand : operands) {
+        CHECK_EQ(instruction.read_operand(offset), operand);
+      }
+      CHECK_EQ(offset, instruction.count());
+    }
+
+    SUBCASE("Overlong operands are consumed without reading bits beyond the width") {
+      std::vector<std::byte> data(12, std::byte{0x81});
+      data.push_back(std::byte{0x01});
+      data.push_back(std::byte{0x05});
+      const Litr::CLI::Instruction instruction{data};
+
+      size_t offset{0};
+      static_cast<void>(instruction.read_operand(offset));
+      CHECK_EQ(offset, 13U);
+      CHECK_EQ(instruction.read_operand(offset), 5U);
+    }
+  }
+
+  TEST_CASE("Constants") {
+    SUBCASE("Equal values share the same index") {
+      Litr::CLI::Instruction instruction{};
+
+      const size_t first{instruction.write_constant("build")};
+      const size_t second{instruction.write_constant(std::string{"build"})};
+      const size_t third{instruction.write_constant("test")};
+
+      CHECK_EQ(first, second);
+      CHECK_NE(first, third);
+      CHECK_EQ(instruction.read_constant(third), "test");
+    }
+
+    SUBCASE("Indexes are not limited to a byte") {
+      Litr::CLI::Instruction instruction{};
+
+      size_t index{0};
+      for (size_t value{0}; value < 1000; ++value) {
+        index = instruction.write_constant(std::to_string(value));
+      }
+
+      CHECK_EQ(index, 999U);
+      CHECK_EQ(instruction.read_constant(300), "300");
+    }
+  }
+}
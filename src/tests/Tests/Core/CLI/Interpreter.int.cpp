@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/CLI/Interpreter.hpp"
+
+#include <doctest/doctest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+
+#include "Core/CLI/OutputCache.hpp"
+#include "Core/CLI/Parser.hpp"
+#include "Core/CLI/Resources.hpp"
+#include "Core/CLI/Throttle.hpp"
+#include "Core/Config/Loader.hpp"
+#include "Core/Environment.hpp"
+#include "Core/Error/Handler.hpp"
+#include "Core/Process.hpp"
+#include "Core/ProcessTracer.hpp"
+#include "Core/Utils.hpp"
+
+TEST_SUITE("CLI::Interpreter") {
+  TEST_CASE("Stops on errors of a command built once used") {
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    Litr::CLI::Parser parser{instruction, "broken, fine"};
+    const auto config{std::make_shared<Litr::Config::Loader>(
+        Litr::Path{"../../Fixtures/Interpreter/litr.toml"}, Litr::Config::Loader::Mode::LAZY)};
+    CHECK_FALSE(Litr::Error::Handler::has_errors());
+
+    std::string output{};
+    size_t executions{0};
+    Litr::CLI::Interpreter interpreter{instruction, config};
+    interpreter.set_output([&output](const std::string& line) { output.append(line); });
+    interpreter.set_execution_hook(
+        [&executions](const Litr::CLI::Instruction::Value&, const std::function<void()>& execute) {
+          ++executions;
+          execute();
+        });
+    interpreter.execute();
+
+    CHECK(Litr::Error::Handler::has_errors());
+    CHECK_EQ(executions, 0U);
+    CHECK_EQ(output, "");
+    Litr::Error::Handler::flush();
+  }
+
+  TEST_CASE("Fails on any exit code but zero") {
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    Litr::CLI::Parser parser{instruction, "exits"};
+    const auto config{std::make_shared<Litr::Config::Loader>(
+        Litr::Path{"../../Fixtures/Interpreter/litr.toml"}, Litr::Config::Loader::Mode::LAZY)};
+
+    Litr::CLI::Interpreter interpreter{instruction, config};
+    interpreter.set_output([](const std::string&) {});
+    interpreter.execute();
+
+    CHECK(Litr::Error::Handler::has_errors());
+    Litr::Error::Handler::flush();
+  }
+
+// CPUs are only bound to on Linux, everywhere else the command just runs.
+#ifdef __linux__
+  TEST_CASE("Fails if the limits of a command cannot be applied") {
+    if (!Litr::Process::is_supported()) {
+      return;
+    }
+
+    // There is no CPU 1023 to bind to, the process exits with 126 before the script runs.
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    Litr::CLI::Parser parser{instruction, "pinned"};
+    const auto config{std::make_shared<Litr::Config::Loader>(
+        Litr::Path{"../../Fixtures/Interpreter/litr.toml"}, Litr::Config::Loader::Mode::LAZY)};
+
+    std::string output{};
+    Litr::CLI::Interpreter interpreter{instruction, config};
+    interpreter.set_output([&output](const std::string& line) { output.append(line); });
+    interpreter.execute();
+
+    CHECK(Litr::Error::Handler::has_errors());
+    CHECK_EQ(output.find("pinned"), std::string::npos);
+    Litr::Error::Handler::flush();
+  }
+#endif
+
+  TEST_CASE("Expands directory patterns again on every execution") {
+    const std::filesystem::path root{
+        std::filesystem::temp_directory_path() / "litr-interpreter-patterns"};
+    std::filesystem::create_directories(root / "packages" / "one");
+    std::ofstream{root / "litr.toml"}
+        << "[commands]\nlist = { script = \"pwd\", dir = \"packages/*\" }\n";
+
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    Litr::CLI::Parser parser{instruction, "list"};
+    const auto config{
+        std::make_shared<Litr::Config::Loader>(Litr::Path{(root / "litr.toml").string()})};
+
+    std::string output{};
+    Litr::CLI::Interpreter interpreter{instruction, config};
+    interpreter.set_output([&output](const std::string& line) { output.append(line); });
+    interpreter.execute();
+    CHECK_NE(output.find("one"), std::string::npos);
+    CHECK_EQ(output.find("two"), std::string::npos);
+
+    output.clear();
+    std::filesystem::create_directories(root / "packages" / "two");
+    interpreter.execute();
+    CHECK_NE(output.find("one"), std::string::npos);
+    CHECK_NE(output.find("two"), std::string::npos);
+    CHECK_EQ(interpreter.get_used_directories().size(), 2);
+
+    CHECK_FALSE(Litr::Error::Handler::has_errors());
+    std::filesystem::remove_all(root);
+  }
+
+  TEST_CASE("Fails if a directory pattern matches no directory") {
+    const std::filesystem::path root{
+        std::filesystem::temp_directory_path() / "litr-interpreter-no-match"};
+    std::filesystem::create_directories(root);
+    std::ofstream{root / "litr.toml"}
+        << "[commands]\nlist = { script = \"pwd\", dir = \"packages/*\" }\n";
+
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    Litr::CLI::Parser parser{instruction, "list"};
+    const auto config{
+        std::make_shared<Litr::Config::Loader>(Litr::Path{(root / "litr.toml").string()})};
+
+    std::string output{};
+    Litr::CLI::Interpreter interpreter{instruction, config};
+    interpreter.set_output([&output](const std::string& line) { output.append(line); });
+    interpreter.execute();
+
+    const auto errors{Litr::Error::Handler::get_errors()};
+    REQUIRE_EQ(errors.size(), 1);
+    CHECK_NE(errors[0].message.find("packages/*"), std::string::npos);
+    CHECK_EQ(output, "");
+    Litr::Error::Handler::flush();
+    std::filesystem::remove_all(root);
+  }
+
+  TEST_CASE("Keeps traced inputs of scripts without a directory per current one") {
+    if (!Litr::ProcessTracer::is_supported()) {
+      return;
+    }
+
+    const std::filesystem::path current{std::filesystem::current_path()};
+    const std::filesystem::path root{
+        std::filesystem::temp_directory_path() / "litr-interpreter-traced"};
+    std::filesystem::create_directories(root / "one");
+    std::filesystem::create_directories(root / "two");
+    std::ofstream{root / "one" / "input"} << "one";
+    std::ofstream{root / "two" / "input"} << "two";
+
+    // Traced inputs are kept in the cache directory, a script of its own starts unknown.
+    const std::string script{"cat input # " + std::to_string(std::random_device{}())};
+    std::ofstream{root / "litr.toml"}
+        << "[commands]\nread = { script = \"" << script << "\", inputs = \"traced\" }\n";
+
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    Litr::CLI::Parser parser{instruction, "read"};
+    const auto config{
+        std::make_shared<Litr::Config::Loader>(Litr::Path{(root / "litr.toml").string()})};
+
+    std::string output{};
+    Litr::CLI::Interpreter interpreter{instruction, config};
+    interpreter.set_output([&output](const std::string& line) { output.append(line); });
+    const Litr::Path inputs{Litr::Environment::get_cache_directory().append(std::string{"inputs"})};
+
+    std::filesystem::current_path(root / "one");
+    interpreter.execute();
+    CHECK_NE(output.find("one"), std::string::npos);
+    const std::string first_key{
+        Litr::Utils::to_hex(Litr::CLI::OutputCache::create_key(script, Litr::Path{""}, {}))};
+
+    output.clear();
+    std::filesystem::current_path(root / "two");
+    interpreter.execute();
+    CHECK_NE(output.find("two"), std::string::npos);
+    const std::string second_key{
+        Litr::Utils::to_hex(Litr::CLI::OutputCache::create_key(script, Litr::Path{""}, {}))};
+
+    CHECK_FALSE(Litr::Error::Handler::has_errors());
+    std::filesystem::current_path(current);
+    std::filesystem::remove(inputs.append(first_key).to_string());
+    std::filesystem::remove(inputs.append(second_key).to_string());
+    std::filesystem::remove_all(root);
+  }
+
+  TEST_CASE("Ends a running script once cancelled") {
+    if (!Litr::Process::is_supported()) {
+      return;
+    }
+
+    const std::filesystem::path root{
+        std::filesystem::temp_directory_path() / "litr-interpreter-cancel"};
+    std::filesystem::create_directories(root);
+    std::ofstream{root / "litr.toml"}
+        << "[commands]\nwait = { script = [\"sleep 30\", \"echo done\"] }\n";
+
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    Litr::CLI::Parser parser{instruction, "wait"};
+    const auto config{
+        std::make_shared<Litr::Config::Loader>(Litr::Path{(root / "litr.toml").string()})};
+
+    std::string output{};
+    Litr::CLI::Interpreter interpreter{instruction, config};
+    interpreter.set_output([&output](const std::string& line) { output.append(line); });
+    const auto start{std::chrono::steady_clock::now()};
+    interpreter.set_cancel_check(
+        [&start]() { return std::chrono::steady_clock::now() - start > std::chrono::seconds{1}; });
+    interpreter.execute();
+
+    CHECK(interpreter.is_cancelled());
+    CHECK_FALSE(Litr::Error::Handler::has_errors());
+    CHECK_EQ(output.find("done"), std::string::npos);
+    CHECK_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds{5});
+    std::filesystem::remove_all(root);
+  }
+
+  TEST_CASE("Holds no place of the throttle while waiting for resources") {
+    const std::filesystem::path root{
+        std::filesystem::temp_directory_path() / "litr-interpreter-resources"};
+    std::filesystem::create_directories(root);
+    std::ofstream{root / "litr.toml"}
+        << "[commands]\nmigrate = { script = \"echo migrated\", resources = { db = 1 } }\n";
+
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    Litr::CLI::Parser parser{instruction, "migrate"};
+    const auto config{
+        std::make_shared<Litr::Config::Loader>(Litr::Path{(root / "litr.toml").string()})};
+
+    const auto resources{
+        std::make_shared<Litr::CLI::Resources>(Litr::CLI::Resources::Capacities{})};
+    const std::array<Litr::Config::Command::Resource, 1> demand{
+        Litr::Config::Command::Resource{"db", 1}};
+    Litr::CLI::Throttle throttle{1, 1, {}};
+    std::atomic<bool> has_place{false};
+
+    std::string output{};
+    Litr::CLI::Interpreter interpreter{instruction, config};
+    interpreter.set_output([&output](const std::string& line) { output.append(line); });
+    interpreter.set_resources(resources);
+    interpreter.set_throttle(&throttle);
+
+    resources->acquire({demand.data(), demand.size()});
+    std::thread run{[&interpreter]() { interpreter.execute(); }};
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+
+    // The only place is free for others, as long as the command waits for the database.
+    std::thread other{[&throttle, &has_place]() {
+      const Litr::CLI::Throttle::Slot slot{&throttle};
+      has_place = true;
+    }};
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    CHECK(has_place);
+
+    resources->release({demand.data(), demand.size()});
+    run.join();
+    other.join();
+    CHECK_NE(output.find("migrated"), std::string::npos);
+    std::filesystem::remove_all(root);
+  }
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/CLI/Journal.hpp"
+
+#include <doctest/doctest.h>
+
+#include <memory>
+#include <string>
+
+#include "Core/CLI/Interpreter.hpp"
+#include "Core/CLI/Parser.hpp"
+#include "Core/Config/Loader.hpp"
+#include "Core/Error/Handler.hpp"
+
+TEST_SUITE("CLI::Journal") {
+  TEST_CASE("Creates a new step for every repetition") {
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    Litr::CLI::Parser parser{instruction, "chain"};
+    const auto config{
+        std::make_shared<Litr::Config::Loader>(Litr::Path{"../../Fixtures/Journal/litr.toml"})};
+
+    Litr::CLI::Journal journal{instruction, config, false};
+    const Litr::CLI::Journal::Step first{journal.create_step("chain", "", "echo one")};
+    const Litr::CLI::Journal::Step second{journal.create_step("chain", "", "echo one")};
+    CHECK_NE(first, second);
+    CHECK_EQ(first.size(), 16);
+
+    // Another journal of the same invocation creates the same steps.
+    Litr::CLI::Journal other{instruction, config, false};
+    CHECK_EQ(other.create_step("chain", "", "echo one"), first);
+    CHECK_EQ(other.create_step("chain", "", "echo one"), second);
+    CHECK_NE(other.create_step("chain", "", "echo two"), first);
+  }
+
+  TEST_CASE("Keys depend on parameters") {
+    const auto config{
+        std::make_shared<Litr::Config::Loader>(Litr::Path{"../../Fixtures/Journal/litr.toml"})};
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    const auto other_instruction{std::make_shared<Litr::CLI::Instruction>()};
+    const auto resume_instruction{std::make_shared<Litr::CLI::Instruction>()};
+    Litr::CLI::Parser parser{instruction, "chain"};
+    Litr::CLI::Parser other_parser{other_instruction, R"(--target="release" chain)"};
+    Litr::CLI::Parser resume_parser{resume_instruction, "--resume chain"};
+
+    const uint64_t key{Litr::CLI::Journal::create_key(instruction, config)};
+    CHECK_NE(Litr::CLI::Journal::create_key(other_instruction, config), key);
+    CHECK_EQ(Litr::CLI::Journal::create_key(resume_instruction, config), key);
+  }
+
+  TEST_CASE("Resumes with the steps done before") {
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    Litr::CLI::Parser parser{instruction, "chain"};
+    const auto config{
+        std::make_shared<Litr::Config::Loader>(Litr::Path{"../../Fixtures/Journal/litr.toml"})};
+
+    Litr::CLI::Journal journal{instruction, config, false};
+    const Litr::CLI::Journal::Step step{journal.create_step("chain", "", "echo one")};
+    journal.mark_done(step);
+    CHECK(journal.is_done(step));
+
+    Litr::CLI::Journal resumed{instruction, config, true};
+    CHECK(resumed.has_steps());
+    CHECK(resumed.is_done(resumed.create_step("chain", "", "echo one")));
+    CHECK_FALSE(resumed.is_done(resumed.create_step("chain", "", "echo two")));
+
+    Litr::CLI::Journal restarted{instruction, config, false};
+    CHECK_FALSE(restarted.has_steps());
+
+    Litr::CLI::Journal removed{instruction, config, true};
+    CHECK_FALSE(removed.has_steps());
+  }
+
+  TEST_CASE("Skips scripts done before") {
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    Litr::CLI::Parser parser{instruction, "chain"};
+    const auto config{std::make_shared<Litr::Config::Loader>(
+        Litr::Path{"../../Fixtures/Journal/litr.toml"}, Litr::Config::Loader::Mode::LAZY)};
+
+    std::string output{};
+    Litr::CLI::Interpreter interpreter{instruction, config};
+    interpreter.set_output([&output](const std::string& line) { output.append(line); });
+    interpreter.set_journal(std::make_shared<Litr::CLI::Journal>(instruction, config, false));
+    interpreter.execute();
+    CHECK_EQ(output, "one\ntwo\n");
+
+    output.clear();
+    const auto journal{std::make_shared<Litr::CLI::Journal>(instruction, config, true)};
+    interpreter.set_journal(journal);
+    interpreter.execute();
+    CHECK_EQ(output, "");
+
+    journal->remove();
+    CHECK_FALSE(Litr::Error::Handler::has_errors());
+  }
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/CLI/Options.hpp"
+
+#include <doctest/doctest.h>
+
+#include <memory>
+
+#include "Core/CLI/Parser.hpp"
+#include "Core/Error/Handler.hpp"
+
+TEST_SUITE("CLI::Options") {
+  TEST_CASE("Collects built-in options") {
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    Litr::CLI::Parser parser{instruction, "--perf build"};
+    const Litr::CLI::Options options{instruction};
+
+    CHECK_FALSE(parser.has_errors());
+    CHECK(options.has("perf"));
+    CHECK_EQ(options.get("perf"), "");
+    Litr::Error::Handler::flush();
+  }
+
+  TEST_CASE("Ignores configured parameters") {
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    Litr::CLI::Parser parser{instruction, R"(--target="release" build)"};
+    const Litr::CLI::Options options{instruction};
+
+    CHECK_FALSE(parser.has_errors());
+    CHECK_FALSE(options.has("target"));
+    CHECK_FALSE(options.has("perf"));
+    Litr::Error::Handler::flush();
+  }
+
+  TEST_CASE("Finds options inside a command scope") {
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    Litr::CLI::Parser parser{instruction, R"(build --perf="true", run)"};
+    const Litr::CLI::Options options{instruction};
+
+    CHECK_FALSE(parser.has_errors());
+    CHECK_EQ(options.get("perf"), "true");
+    Litr::Error::Handler::flush();
+  }
+
+  TEST_CASE("Built-in option names are known") {
+    CHECK(Litr::CLI::Options::is_builtin("perf"));
+    CHECK_FALSE(Litr::CLI::Options::is_builtin("target"));
+  }
+}
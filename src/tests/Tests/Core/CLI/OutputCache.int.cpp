@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/CLI/OutputCache.hpp"
+
+#include <doctest/doctest.h>
+
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <string_view>
+
+TEST_SUITE("CLI::OutputCache") {
+  TEST_CASE("Keeps output until it expires") {
+    const std::filesystem::path directory{
+        std::filesystem::temp_directory_path() / "litr-output-cache"};
+    std::filesystem::remove_all(directory);
+
+    const Litr::CLI::OutputCache cache{Litr::Path{directory.string()}};
+    const uint64_t key{Litr::CLI::OutputCache::create_key("nproc", Litr::Path{""}, {})};
+    CHECK_FALSE(cache.get(key, std::chrono::minutes{10}).has_value());
+
+    cache.set(key, {Litr::ExitStatus::SUCCESS, "8\n"});
+
+    const auto result{cache.get(key, std::chrono::minutes{10})};
+    REQUIRE(result.has_value());
+    CHECK_EQ(result->status, Litr::ExitStatus::SUCCESS);
+    CHECK_EQ(result->message, "8\n");
+    CHECK_FALSE(cache.get(key, std::chrono::seconds{0}).has_value());
+
+    std::filesystem::remove_all(directory);
+  }
+
+  TEST_CASE("Keys depend on script, directory and environment") {
+    const uint64_t key{Litr::CLI::OutputCache::create_key("nproc", Litr::Path{"a"}, {})};
+    CHECK_EQ(Litr::CLI::OutputCache::create_key("nproc", Litr::Path{"a"}, {}), key);
+    CHECK_NE(Litr::CLI::OutputCache::create_key("nproc --all", Litr::Path{"a"}, {}), key);
+    CHECK_NE(Litr::CLI::OutputCache::create_key("nproc", Litr::Path{"b"}, {}), key);
+
+    // Listed variables are part of the key, even if they are not set.
+    const std::array<std::string_view, 1> variables{"LITR_OUTPUT_CACHE_UNSET"};
+    CHECK_NE(Litr::CLI::OutputCache::create_key(
+                 "nproc", Litr::Path{"a"}, {variables.data(), variables.size()}),
+        key);
+  }
+
+  TEST_CASE("Keys of scripts without a directory depend on the current one") {
+    const std::filesystem::path current{std::filesystem::current_path()};
+    const std::filesystem::path directory{
+        std::filesystem::temp_directory_path() / "litr-output-cache-cwd"};
+    std::filesystem::create_directories(directory);
+
+    const uint64_t key{Litr::CLI::OutputCache::create_key("nproc", Litr::Path{""}, {})};
+    CHECK_EQ(Litr::CLI::OutputCache::create_key("nproc", Litr::Path{"."}, {}), key);
+
+    std::filesystem::current_path(directory);
+    CHECK_NE(Litr::CLI::OutputCache::create_key("nproc", Litr::Path{""}, {}), key);
+
+    std::filesystem::current_path(current);
+    std::filesystem::remove_all(directory);
+  }
+}
@@ -9,6 +9,8 @@
 
 #include <array>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "Core/Error/Handler.hpp"
 
@@ -25,15 +27,14 @@ inline void check_definition(const std::shared_ptr<Litr::CLI::Instruction>& inst
   while (offset < instruction->count()) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
     const auto& test{definition[iteration]};
-    const Litr::CLI::Instruction::Code code{(instruction)->read(offset++)};
+    const auto code{static_cast<Litr::CLI::Instruction::Code>(instruction->read(offset++))};
     switch (code) {
       case Litr::CLI::Instruction::Code::CONSTANT:
       case Litr::CLI::Instruction::Code::DEFINE:
       case Litr::CLI::Instruction::Code::BEGIN_SCOPE:
       case Litr::CLI::Instruction::Code::EXECUTE: {
-        const std::byte index{instruction->read(offset)};
+        const size_t index{instruction->read_operand(offset)};
         const Litr::CLI::Instruction::Value constant{instruction->read_constant(index)};
-        offset += 1;
         CHECK_EQ(test.code, code);
         CHECK_EQ(test.value, constant);
         break;
@@ -95,6 +96,22 @@ TEST_SUITE("CLI::Parser") {
     Litr::Error::Handler::flush();
   }
 
+  TEST_CASE("Parameter with empty string followed by a command") {
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    const std::string source{R"(--target="" build)"};
+
+    Litr::CLI::Parser parser{instruction, source};
+    const std::array<InstructionDefinition, 4> definition{
+        {{Litr::CLI::Instruction::Code::DEFINE, "target"},
+            {Litr::CLI::Instruction::Code::CONSTANT, ""},
+            {Litr::CLI::Instruction::Code::BEGIN_SCOPE, "build"},
+            {Litr::CLI::Instruction::Code::EXECUTE, "build"}}};
+
+    CHECK_FALSE(parser.has_errors());
+    check_definition(instruction, definition);
+    Litr::Error::Handler::flush();
+  }
+
   TEST_CASE("Single command") {
     const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
     const std::string source{"build"};
@@ -175,6 +192,42 @@ TEST_SUITE("CLI::Parser") {
     Litr::Error::Handler::flush();
   }
 
+  TEST_CASE("Arguments with unchanged values") {
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    const std::vector<std::string> arguments{
+        "build", "--target=a=b", R"(-m="quoted")", "--empty=", "cpp"};
+
+    Litr::CLI::Parser parser{instruction, arguments};
+    const std::array<InstructionDefinition, 9> definition{
+        {{Litr::CLI::Instruction::Code::BEGIN_SCOPE, "build"},
+            {Litr::CLI::Instruction::Code::DEFINE, "target"},
+            {Litr::CLI::Instruction::Code::CONSTANT, "a=b"},
+            {Litr::CLI::Instruction::Code::DEFINE, "m"},
+            {Litr::CLI::Instruction::Code::CONSTANT, R"("quoted")"},
+            {Litr::CLI::Instruction::Code::DEFINE, "empty"},
+            {Litr::CLI::Instruction::Code::CONSTANT, ""},
+            {Litr::CLI::Instruction::Code::BEGIN_SCOPE, "cpp"},
+            {Litr::CLI::Instruction::Code::EXECUTE, "build.cpp"}}};
+
+    CHECK_FALSE(parser.has_errors());
+    check_definition(instruction, definition);
+    Litr::Error::Handler::flush();
+  }
+
+  TEST_CASE("Invalid arguments") {
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    const std::vector<std::string> arguments{","};
+
+    Litr::CLI::Parser parser{instruction, arguments};
+
+    CHECK(parser.has_errors());
+
+    const auto errors{Litr::Error::Handler::get_errors()};
+    CHECK_EQ(errors.size(), 1);
+    CHECK_EQ(errors[0].message, "Cannot parse at `,`: Unexpected comma.");
+    Litr::Error::Handler::flush();
+  }
+
   TEST_CASE("Invalid comma operator") {
     const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
     const std::string source{","};
@@ -409,4 +462,34 @@ TEST_SUITE("CLI::Parser") {
         errors[0].message, "Cannot parse: A parameter can only start with the characters A-Za-z.");
     Litr::Error::Handler::flush();
   }
+
+  TEST_CASE("More constants than fit into a single byte operand") {
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    constexpr size_t command_count{1000};
+    std::string source{};
+    for (size_t index{0}; index < command_count; ++index) {
+      source.append(fmt::format("{}command{}", index == 0 ? "" : ", ", index));
+    }
+
+    Litr::CLI::Parser parser{instruction, source};
+    CHECK_FALSE(parser.has_errors());
+
+    size_t scopes{0};
+    size_t offset{0};
+    while (offset < instruction->count()) {
+      const auto code{static_cast<Litr::CLI::Instruction::Code>(instruction->read(offset++))};
+      if (code == Litr::CLI::Instruction::Code::CLEAR) {
+        continue;
+      }
+
+      const Litr::CLI::Instruction::Value value{
+          instruction->read_constant(instruction->read_operand(offset))};
+      if (code == Litr::CLI::Instruction::Code::BEGIN_SCOPE) {
+        CHECK_EQ(value, fmt::format("command{}", scopes++));
+      }
+    }
+
+    CHECK_EQ(scopes, command_count);
+    Litr::Error::Handler::flush();
+  }
 }
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/CLI/Resources.hpp"
+
+#include <doctest/doctest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+TEST_SUITE("CLI::Resources") {
+  using Resource = Litr::Config::Command::Resource;
+
+  TEST_CASE("Shares a resource up to its capacity") {
+    Litr::CLI::Resources resources{{{"memory_gb", 16}}};
+    const std::array<Resource, 1> demand{Resource{"memory_gb", 8}};
+    std::atomic<bool> has_started{false};
+
+    resources.acquire({demand.data(), demand.size()});
+    resources.acquire({demand.data(), demand.size()});
+
+    std::thread third{[&resources, &demand, &has_started]() {
+      const Litr::CLI::Resources::Lease lease{&resources, {demand.data(), demand.size()}};
+      has_started = true;
+    }};
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    CHECK_FALSE(has_started);
+
+    resources.release({demand.data(), demand.size()});
+    third.join();
+    CHECK(has_started);
+
+    resources.release({demand.data(), demand.size()});
+  }
+
+  TEST_CASE("Takes a resource without a capacity one at a time") {
+    Litr::CLI::Resources resources{{}};
+    const std::array<Resource, 1> demand{Resource{"db", 1}};
+    std::atomic<bool> has_started{false};
+
+    resources.acquire({demand.data(), demand.size()});
+
+    std::thread second{[&resources, &demand, &has_started]() {
+      const Litr::CLI::Resources::Lease lease{&resources, {demand.data(), demand.size()}};
+      has_started = true;
+    }};
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    CHECK_FALSE(has_started);
+
+    resources.release({demand.data(), demand.size()});
+    second.join();
+    CHECK(has_started);
+  }
+
+  TEST_CASE("Limits a demand above the capacity to the whole capacity") {
+    Litr::CLI::Resources resources{{{"memory_gb", 4}}};
+    const std::array<Resource, 1> demand{Resource{"memory_gb", 8}};
+
+    // Would wait forever if the demand was not limited.
+    { const Litr::CLI::Resources::Lease lease{&resources, {demand.data(), demand.size()}}; }
+    { const Litr::CLI::Resources::Lease lease{&resources, {demand.data(), demand.size()}}; }
+  }
+
+  TEST_CASE("Does nothing without resources") {
+    const std::array<Resource, 1> demand{Resource{"db", 1}};
+    const Litr::CLI::Resources::Lease lease{nullptr, {demand.data(), demand.size()}};
+  }
+}
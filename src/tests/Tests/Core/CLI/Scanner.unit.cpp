@@ -7,6 +7,8 @@
 #include <doctest/doctest.h>
 
 #include <array>
+#include <string>
+#include <vector>
 
 struct TokenDefinition {
   Litr::CLI::TokenType type;
@@ -198,6 +200,53 @@ TEST_SUITE("CLI::Scanner") {
     check_eos_token(scanner);
   }
 
+  TEST_CASE("Arguments with commands and parameters") {
+    const std::vector<std::string> arguments{"build", "--target=release", "cpp"};
+    Litr::CLI::Scanner scanner{arguments};
+
+    std::array<TokenDefinition, 5> definition{{
+        {Litr::CLI::TokenType::COMMAND, "build"},
+        {Litr::CLI::TokenType::LONG_PARAMETER, "--target"},
+        {Litr::CLI::TokenType::EQUAL, "="},
+        {Litr::CLI::TokenType::VALUE, "release"},
+        {Litr::CLI::TokenType::COMMAND, "cpp"},
+    }};
+
+    check_definition(scanner, definition);
+    check_eos_token(scanner);
+  }
+
+  TEST_CASE("Argument values are taken as is") {
+    const std::vector<std::string> arguments{
+        "--target=a=b", R"(-t="quoted")", "--name= with spaces ", "--empty="};
+    Litr::CLI::Scanner scanner{arguments};
+
+    std::array<TokenDefinition, 12> definition{{
+        {Litr::CLI::TokenType::LONG_PARAMETER, "--target"},
+        {Litr::CLI::TokenType::EQUAL, "="},
+        {Litr::CLI::TokenType::VALUE, "a=b"},
+        {Litr::CLI::TokenType::SHORT_PARAMETER, "-t"},
+        {Litr::CLI::TokenType::EQUAL, "="},
+        {Litr::CLI::TokenType::VALUE, R"("quoted")"},
+        {Litr::CLI::TokenType::LONG_PARAMETER, "--name"},
+        {Litr::CLI::TokenType::EQUAL, "="},
+        {Litr::CLI::TokenType::VALUE, " with spaces "},
+        {Litr::CLI::TokenType::LONG_PARAMETER, "--empty"},
+        {Litr::CLI::TokenType::EQUAL, "="},
+        {Litr::CLI::TokenType::VALUE, ""},
+    }};
+
+    check_definition(scanner, definition);
+    check_eos_token(scanner);
+  }
+
+  TEST_CASE("No arguments") {
+    const std::vector<std::string> arguments{};
+    Litr::CLI::Scanner scanner{arguments};
+
+    check_eos_token(scanner);
+  }
+
   // Error cases
   TEST_CASE("Invalidates unterminated string syntax") {
     Litr::CLI::Scanner scanner{"\"str"};
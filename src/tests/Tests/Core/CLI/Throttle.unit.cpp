@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/CLI/Throttle.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+
+TEST_SUITE("CLI::Throttle") {
+  constexpr uint64_t gigabyte{1024ULL * 1024 * 1024};
+
+  Litr::SystemLoad::Sample create_calm_sample() {
+    Litr::SystemLoad::Sample sample{};
+    sample.load_average = 1.0;
+    sample.cpu_pressure = 0.0;
+    sample.memory_pressure = 0.0;
+    sample.io_pressure = 0.0;
+    sample.memory_available = 12 * gigabyte;
+    sample.memory_total = 16 * gigabyte;
+    return sample;
+  }
+
+  TEST_CASE("Starts within its bounds") {
+    size_t reports{0};
+    Litr::CLI::Throttle throttle{2, 3, [&reports](size_t from, auto&& decision) {
+      CHECK_EQ(from, 0);
+      CHECK_FALSE(decision.reason.empty());
+      ++reports;
+    }};
+
+    CHECK_EQ(reports, 1);
+    CHECK_GE(throttle.get_limit(), 2);
+    CHECK_LE(throttle.get_limit(), 3);
+  }
+
+  TEST_CASE("Starts with the cores left free") {
+    const Litr::CLI::Throttle throttle{1, 8, 8, nullptr};
+    Litr::SystemLoad::Sample sample{create_calm_sample()};
+    sample.load_average = 5.2;
+
+    CHECK_EQ(throttle.decide_initial(sample).limit, 3);
+    CHECK_EQ(throttle.decide_initial(sample).reason, "3 of 8 cores free");
+    CHECK_EQ(throttle.decide_initial({}).limit, 8);
+  }
+
+  TEST_CASE("Halves the limit if memory runs out") {
+    const Litr::CLI::Throttle throttle{1, 8, 8, nullptr};
+    Litr::SystemLoad::Sample sample{create_calm_sample()};
+
+    sample.memory_pressure = 25.0;
+    CHECK_EQ(throttle.decide(6, sample).limit, 3);
+    CHECK_EQ(throttle.decide(6, sample).reason, "memory pressure at 25.0%");
+
+    sample.memory_pressure = 0.0;
+    sample.memory_available = gigabyte;
+    CHECK_EQ(throttle.decide(6, sample).limit, 3);
+    CHECK_EQ(throttle.decide(1, sample).limit, 1);
+  }
+
+  TEST_CASE("Lowers the limit by one on a busy machine") {
+    const Litr::CLI::Throttle throttle{2, 8, 4, nullptr};
+    Litr::SystemLoad::Sample sample{create_calm_sample()};
+
+    sample.cpu_pressure = 75.0;
+    CHECK_EQ(throttle.decide(5, sample).limit, 4);
+    CHECK_EQ(throttle.decide(2, sample).limit, 2);
+
+    sample.cpu_pressure = 0.0;
+    sample.load_average = 7.0;
+    CHECK_EQ(throttle.decide(5, sample).limit, 4);
+  }
+
+  TEST_CASE("Raises the limit by one on a calm machine") {
+    const Litr::CLI::Throttle throttle{1, 4, 8, nullptr};
+
+    CHECK_EQ(throttle.decide(2, create_calm_sample()).limit, 3);
+    CHECK_EQ(throttle.decide(4, create_calm_sample()).limit, 4);
+    CHECK(throttle.decide(4, create_calm_sample()).reason.empty());
+  }
+
+  TEST_CASE("Keeps the limit knowing nothing of the machine") {
+    const Litr::CLI::Throttle throttle{1, 4, 8, nullptr};
+
+    CHECK_EQ(throttle.decide(2, {}).limit, 2);
+    CHECK(throttle.decide(2, {}).reason.empty());
+  }
+
+  TEST_CASE("Does nothing without a throttle") {
+    const Litr::CLI::Throttle::Slot slot{nullptr};
+  }
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/CLI/TracedInputs.hpp"
+
+#include <doctest/doctest.h>
+
+#include <filesystem>
+#include <fstream>
+
+TEST_SUITE("CLI::TracedInputs") {
+  TEST_CASE("Tells if any traced file changed") {
+    const std::filesystem::path directory{
+        std::filesystem::temp_directory_path() / "litr-traced-inputs"};
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory / "files");
+
+    const std::filesystem::path input{directory / "files" / "input.txt"};
+    const std::filesystem::path missing{directory / "files" / "missing.txt"};
+    std::ofstream{input} << "one";
+
+    const Litr::CLI::TracedInputs inputs{Litr::Path{(directory / "cache").string()}};
+    CHECK_FALSE(inputs.is_unchanged(1));
+
+    inputs.set(1, {input.string(), missing.string()});
+    CHECK(inputs.is_unchanged(1));
+    CHECK_FALSE(inputs.is_unchanged(2));
+
+    SUBCASE("Changed content") {
+      std::ofstream{input} << "changed";
+      CHECK_FALSE(inputs.is_unchanged(1));
+    }
+
+    SUBCASE("Created file") {
+      std::ofstream{missing} << "new";
+      CHECK_FALSE(inputs.is_unchanged(1));
+    }
+
+    SUBCASE("Removed file") {
+      std::filesystem::remove(input);
+      CHECK_FALSE(inputs.is_unchanged(1));
+    }
+
+    std::filesystem::remove_all(directory);
+  }
+}
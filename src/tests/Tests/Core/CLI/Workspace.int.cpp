@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/CLI/Workspace.hpp"
+
+#include <doctest/doctest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+#include "Core/CLI/Parser.hpp"
+#include "Core/Error/Handler.hpp"
+#include "Core/FileSystem.hpp"
+
+TEST_SUITE("CLI::Workspace") {
+  TEST_CASE("Finds every package configuration") {
+    const Litr::Path root{"../../Fixtures/Workspace"};
+    const auto packages{Litr::CLI::Workspace::find_packages(root)};
+
+    REQUIRE_EQ(packages.size(), 4);
+    CHECK_EQ(packages[0].name, ".");
+    CHECK_EQ(packages[1].name, "packages/api");
+    CHECK_EQ(packages[2].name, "packages/broken");
+    CHECK_EQ(packages[3].name, "packages/web");
+    CHECK_EQ(packages[3].file_path.filename(), ".litr.toml");
+  }
+
+  TEST_CASE("Skips packages ignored by git") {
+    // Generated files cannot be part of the fixtures, git would ignore them as well.
+    std::filesystem::create_directories("../../Fixtures/Workspace/generated");
+    std::ofstream{"../../Fixtures/Workspace/generated/litr.toml"} << "[commands]\n";
+
+    const Litr::Path root{"../../Fixtures/Workspace"};
+    const auto packages{Litr::CLI::Workspace::find_packages(root)};
+
+    CHECK_EQ(packages.size(), 4);
+    std::filesystem::remove_all("../../Fixtures/Workspace/generated");
+  }
+
+  TEST_CASE("Runs a command in every package defining it") {
+    const auto instruction{std::make_shared<Litr::CLI::Instruction>()};
+    Litr::CLI::Parser parser{instruction, "build"};
+    Litr::CLI::Workspace workspace{instruction, Litr::Path{"../../Fixtures/Workspace"}};
+
+    workspace.run(2);
+    const auto& results{workspace.get_results()};
+
+    REQUIRE_EQ(results.size(), 4);
+    CHECK_EQ(results[0].status, Litr::CLI::Workspace::Status::SUCCESS);
+    CHECK_EQ(results[0].output, "root\n");
+    CHECK_EQ(results[1].status, Litr::CLI::Workspace::Status::SUCCESS);
+    CHECK_EQ(results[1].output, "api\n");
+    CHECK_EQ(results[2].status, Litr::CLI::Workspace::Status::FAILURE);
+    CHECK_EQ(results[2].errors.size(), 1);
+    CHECK_EQ(results[3].status, Litr::CLI::Workspace::Status::SKIPPED);
+    CHECK(workspace.has_failures());
+
+    // Errors of packages stay with their result.
+    CHECK_FALSE(Litr::Error::Handler::has_errors());
+  }
+}
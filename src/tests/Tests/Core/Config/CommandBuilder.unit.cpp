@@ -13,7 +13,8 @@ TEST_SUITE("Config::CommandBuilder") {
   TEST_CASE("Initiates a Command on construction") {
     const auto [context, data] = create_toml_mock("test", "");
 
-    Litr::Config::CommandBuilder builder{context, data, "test"};
+    Litr::Config::CommandTable table{};
+    Litr::Config::CommandBuilder builder{table, context, data, "test"};
     Litr::Config::Command builder_result{*builder.get_result()};
     Litr::Config::Command compare{"test"};
 
@@ -26,7 +27,8 @@ TEST_SUITE("Config::CommandBuilder") {
     SUBCASE("Can add multiple lines of script to the command") {
       const auto [context, data] = create_toml_mock("test", "");
 
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_script_line("first line");
       builder.add_script_line("second line");
 
@@ -43,7 +45,8 @@ TEST_SUITE("Config::CommandBuilder") {
     SUBCASE("Can override the whole script at once") {
       const auto [context, data] = create_toml_mock("test", "");
 
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       const std::vector script{"first line", "second line"};
       builder.add_script(script);
 
@@ -59,7 +62,8 @@ TEST_SUITE("Config::CommandBuilder") {
       const auto [context, data] = create_toml_mock("test", "scripts = [1]");
 
       Litr::Config::TomlFileAdapter file{};
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_script(file.find(data, "scripts"));
 
       CHECK_EQ(Litr::Error::Handler::get_errors().size(), 1);
@@ -72,7 +76,8 @@ TEST_SUITE("Config::CommandBuilder") {
       const auto [context, data] = create_toml_mock("test", "scripts = [1, 2, 3]");
 
       Litr::Config::TomlFileAdapter file{};
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_script(file.find(data, "scripts"));
 
       CHECK_EQ(Litr::Error::Handler::get_errors().size(), 1);
@@ -86,7 +91,8 @@ TEST_SUITE("Config::CommandBuilder") {
           create_toml_mock("test", R"(scripts = ["first line", "second line"])");
 
       Litr::Config::TomlFileAdapter file{};
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_script(file.find(data, "scripts"));
 
       const auto result{builder.get_result()};
@@ -102,7 +108,8 @@ TEST_SUITE("Config::CommandBuilder") {
           create_toml_mock("test", R"(scripts = ["first line", "second line"])");
 
       Litr::Config::TomlFileAdapter file{};
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_script(file.find(data, "scripts"));
 
       const auto result{builder.get_result()};
@@ -122,7 +129,8 @@ TEST_SUITE("Config::CommandBuilder") {
     SUBCASE("Does nothing if description is not set") {
       const auto [context, data] = create_toml_mock("test", R"(key = "value")");
 
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_description();
 
       CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
@@ -133,7 +141,8 @@ TEST_SUITE("Config::CommandBuilder") {
     SUBCASE("Emits and error if description is not a string") {
       const auto [context, data] = create_toml_mock("test", R"(description = 42)");
 
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_description();
 
       CHECK_EQ(Litr::Error::Handler::get_errors().size(), 1);
@@ -145,7 +154,8 @@ TEST_SUITE("Config::CommandBuilder") {
     SUBCASE("Extracts the description from toml data") {
       const auto [context, data] = create_toml_mock("test", R"(description = "Text")");
 
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_description();
 
       CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
@@ -158,7 +168,8 @@ TEST_SUITE("Config::CommandBuilder") {
     SUBCASE("Does nothing if example is not set") {
       const auto [context, data] = create_toml_mock("test", R"(key = "value")");
 
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_example();
 
       CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
@@ -169,7 +180,8 @@ TEST_SUITE("Config::CommandBuilder") {
     SUBCASE("Emits and error if example is not a string") {
       const auto [context, data] = create_toml_mock("test", R"(example = 42)");
 
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_example();
 
       CHECK_EQ(Litr::Error::Handler::get_errors().size(), 1);
@@ -181,7 +193,8 @@ TEST_SUITE("Config::CommandBuilder") {
     SUBCASE("Extracts the example from toml data") {
       const auto [context, data] = create_toml_mock("test", R"(example = "Text")");
 
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_example();
 
       CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
@@ -194,7 +207,8 @@ TEST_SUITE("Config::CommandBuilder") {
     SUBCASE("Does nothing if dir is not set") {
       const auto [context, data] = create_toml_mock("test", R"(key = "value")");
 
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_directory(Litr::Path(""));
 
       CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
@@ -205,7 +219,8 @@ TEST_SUITE("Config::CommandBuilder") {
     SUBCASE("Emits an error if dir is not a string or array of strings") {
       const auto [context, data] = create_toml_mock("test", R"(dir = 42)");
 
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_directory(Litr::Path(""));
 
       CHECK_EQ(Litr::Error::Handler::get_errors().size(), 1);
@@ -217,7 +232,8 @@ TEST_SUITE("Config::CommandBuilder") {
     SUBCASE("Emits an error if dir array does not only contain strings") {
       const auto [context, data] = create_toml_mock("test", R"(dir = [1])");
 
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_directory(Litr::Path(""));
 
       CHECK_EQ(Litr::Error::Handler::get_errors().size(), 1);
@@ -229,7 +245,8 @@ TEST_SUITE("Config::CommandBuilder") {
     SUBCASE("Emits more than one error if dir array does not only contain multiple strings") {
       const auto [context, data] = create_toml_mock("test", R"(dir = [1, 2])");
 
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_directory(Litr::Path(""));
 
       CHECK_EQ(Litr::Error::Handler::get_errors().size(), 2);
@@ -243,7 +260,8 @@ TEST_SUITE("Config::CommandBuilder") {
     SUBCASE("Creates a directory folder from a string") {
       const auto [context, data] = create_toml_mock("test", R"(dir = ["folder1"])");
 
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_directory(Litr::Path(""));
 
       CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
@@ -254,7 +272,8 @@ TEST_SUITE("Config::CommandBuilder") {
     SUBCASE("Creates a directory folder from an array of strings") {
       const auto [context, data] = create_toml_mock("test", R"(dir = ["folder1", "folder2"])");
 
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_directory(Litr::Path(""));
 
       CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
@@ -264,11 +283,298 @@ TEST_SUITE("Config::CommandBuilder") {
     }
   }
 
+  TEST_CASE("CommandBuilder::add_affects") {
+    SUBCASE("Does nothing if affects is not set") {
+      const auto [context, data] = create_toml_mock("test", R"(key = "value")");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_affects(Litr::Path(""));
+
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
+      CHECK(builder.get_result()->affects.empty());
+      Litr::Error::Handler::flush();
+    }
+
+    SUBCASE("Emits an error if affects is not a string or array of strings") {
+      const auto [context, data] = create_toml_mock("test", R"(affects = [1])");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_affects(Litr::Path(""));
+
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 1);
+      CHECK_EQ(Litr::Error::Handler::get_errors()[0].message,
+          R"(A "affects" can either be a string or array of strings.)");
+      Litr::Error::Handler::flush();
+    }
+
+    SUBCASE("Creates paths from an array of strings") {
+      const auto [context, data] =
+          create_toml_mock("test", R"(affects = ["packages/core", "shared/*"])");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_affects(Litr::Path(""));
+
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
+      CHECK_EQ(builder.get_result()->affects[0], "packages/core");
+      CHECK_EQ(builder.get_result()->affects[1], "shared/*");
+      CHECK(builder.get_result()->directory.empty());
+      Litr::Error::Handler::flush();
+    }
+  }
+
+  TEST_CASE("CommandBuilder::add_inputs") {
+    SUBCASE("Does nothing if inputs is not set") {
+      const auto [context, data] = create_toml_mock("test", R"(key = "value")");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_inputs();
+
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
+      CHECK_EQ(builder.get_result()->inputs, Litr::Config::Command::Inputs::UNKNOWN);
+      Litr::Error::Handler::flush();
+    }
+
+    SUBCASE("Emits an error if inputs are not traced") {
+      const auto [context, data] = create_toml_mock("test", R"(inputs = "declared")");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_inputs();
+
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 1);
+      CHECK_EQ(Litr::Error::Handler::get_errors()[0].message,
+          R"(The "inputs" can only be "traced" so far.)");
+      Litr::Error::Handler::flush();
+    }
+
+    SUBCASE("Traces inputs") {
+      const auto [context, data] = create_toml_mock("test", R"(inputs = "traced")");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_inputs();
+
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
+      CHECK_EQ(builder.get_result()->inputs, Litr::Config::Command::Inputs::TRACED);
+      Litr::Error::Handler::flush();
+    }
+  }
+
+  TEST_CASE("CommandBuilder::add_cache") {
+    SUBCASE("Does nothing if cache is not set") {
+      const auto [context, data] = create_toml_mock("test", R"(key = "value")");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_cache();
+
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
+      CHECK_EQ(builder.get_result()->cache.ttl.count(), 0);
+      Litr::Error::Handler::flush();
+    }
+
+    SUBCASE("Emits an error if the time to live is missing or invalid") {
+      const auto [context, data] = create_toml_mock("test", R"(cache = { ttl = "10x" })");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_cache();
+
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 1);
+      CHECK_EQ(Litr::Error::Handler::get_errors()[0].message,
+          R"(A "cache" needs a "ttl" duration, e.g. `cache = { ttl = "10m" }`.)");
+      Litr::Error::Handler::flush();
+    }
+
+    SUBCASE("Emits an error if the environment is not an array of strings") {
+      const auto [context, data] =
+          create_toml_mock("test", R"(cache = { ttl = "10m", env = "PATH" })");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_cache();
+
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 1);
+      CHECK_EQ(Litr::Error::Handler::get_errors()[0].message,
+          R"(The "cache" environment can only be an array of strings.)");
+      Litr::Error::Handler::flush();
+    }
+
+    SUBCASE("Creates the cache with time to live and environment") {
+      const auto [context, data] =
+          create_toml_mock("test", R"(cache = { ttl = "1h30m", env = ["PATH", "CC"] })");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_cache();
+
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
+      CHECK_EQ(builder.get_result()->cache.ttl.count(), 5400);
+      CHECK_EQ(builder.get_result()->cache.env.size(), 2);
+      CHECK_EQ(builder.get_result()->cache.env[1], "CC");
+      Litr::Error::Handler::flush();
+    }
+  }
+
+  TEST_CASE("CommandBuilder::add_resources") {
+    SUBCASE("Emits an error if resources are not positive whole numbers") {
+      const auto [context, data] = create_toml_mock("test", R"(resources = { db = "one" })");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_resources();
+
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 1);
+      CHECK_EQ(Litr::Error::Handler::get_errors()[0].message,
+          R"(The "resources" can only be a table of positive whole numbers, )"
+          R"(e.g. `resources = { db = 1 }`.)");
+      Litr::Error::Handler::flush();
+    }
+
+    SUBCASE("Creates resources in order") {
+      const auto [context, data] =
+          create_toml_mock("test", R"(resources = { db = 1, memory_gb = 8 })");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_resources();
+
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
+      REQUIRE_EQ(builder.get_result()->resources.size(), 2);
+      CHECK_EQ(builder.get_result()->resources[0].name, "db");
+      CHECK_EQ(builder.get_result()->resources[0].amount, 1);
+      CHECK_EQ(builder.get_result()->resources[1].name, "memory_gb");
+      CHECK_EQ(builder.get_result()->resources[1].amount, 8);
+      Litr::Error::Handler::flush();
+    }
+  }
+
+  TEST_CASE("CommandBuilder::add_nice") {
+    SUBCASE("Emits an error if nice is out of range") {
+      const auto [context, data] = create_toml_mock("test", R"(nice = 20)");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_nice();
+
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 1);
+      CHECK_EQ(Litr::Error::Handler::get_errors()[0].message,
+          R"(The "nice" can only be a whole number from -20 to 19.)");
+      Litr::Error::Handler::flush();
+    }
+
+    SUBCASE("Sets the niceness") {
+      const auto [context, data] = create_toml_mock("test", R"(nice = 10)");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_nice();
+
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
+      CHECK_EQ(builder.get_result()->limits.nice, 10);
+      Litr::Error::Handler::flush();
+    }
+  }
+
+  TEST_CASE("CommandBuilder::add_cpus") {
+    SUBCASE("Emits an error if cpus is no list of CPUs") {
+      const auto [context, data] = create_toml_mock("test", R"(cpus = "7-0")");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_cpus();
+
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 1);
+      CHECK_EQ(Litr::Error::Handler::get_errors()[0].message,
+          R"(The "cpus" can only be a list of CPU numbers, e.g. `cpus = "0-7,12"`.)");
+      Litr::Error::Handler::flush();
+    }
+
+    SUBCASE("Sets the CPUs") {
+      const auto [context, data] = create_toml_mock("test", R"(cpus = "0-7,12")");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_cpus();
+
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
+      CHECK_EQ(builder.get_result()->limits.cpus, "0-7,12");
+      Litr::Error::Handler::flush();
+    }
+  }
+
+  TEST_CASE("CommandBuilder::add_limits") {
+    SUBCASE("Emits an error for malformed and unknown limits") {
+      const auto [context, data] = create_toml_mock(
+          "test", R"(limits = { memory = "4 GB", open_files = 0, threads = 8 })");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_limits();
+
+      const auto errors{Litr::Error::Handler::get_errors()};
+      REQUIRE_EQ(errors.size(), 3);
+      CHECK_EQ(errors[0].message,
+          R"(The "memory" limit can only be a size, e.g. `memory = "4G"`.)");
+      CHECK_EQ(errors[1].message,
+          R"(The "open_files" limit can only be a positive whole number.)");
+      CHECK_EQ(errors[2].message,
+          R"(The limit "threads" is not known, only "memory" and "open_files" are.)");
+      Litr::Error::Handler::flush();
+    }
+
+    SUBCASE("Sets the limits") {
+      const auto [context, data] =
+          create_toml_mock("test", R"(limits = { memory = "4G", open_files = 65536 })");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_limits();
+
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
+      CHECK_EQ(builder.get_result()->limits.memory, 4294967296ULL);
+      CHECK_EQ(builder.get_result()->limits.open_files, 65536);
+      Litr::Error::Handler::flush();
+    }
+  }
+
+  TEST_CASE("CommandBuilder::add_timeout") {
+    SUBCASE("Emits an error if timeout is no duration") {
+      const auto [context, data] = create_toml_mock("test", R"(timeout = 900)");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_timeout();
+
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 1);
+      CHECK_EQ(Litr::Error::Handler::get_errors()[0].message,
+          R"(The "timeout" can only be a duration, e.g. `timeout = "15m"`.)");
+      Litr::Error::Handler::flush();
+    }
+
+    SUBCASE("Sets the timeout") {
+      const auto [context, data] = create_toml_mock("test", R"(timeout = "15m")");
+
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
+      builder.add_timeout();
+
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
+      CHECK_EQ(builder.get_result()->timeout.count(), 900);
+      Litr::Error::Handler::flush();
+    }
+  }
+
   TEST_CASE("CommandBuilder::add_output") {
     SUBCASE("Does nothing if output is not set") {
       const auto [context, data] = create_toml_mock("test", R"(key = "value")");
 
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_output();
 
       CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
@@ -279,7 +585,8 @@ TEST_SUITE("Config::CommandBuilder") {
     SUBCASE("Emits an error if output type is not known") {
       const auto [context, data] = create_toml_mock("test", R"(output = "unknown")");
 
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_output();
 
       CHECK_EQ(Litr::Error::Handler::get_errors().size(), 1);
@@ -291,7 +598,8 @@ TEST_SUITE("Config::CommandBuilder") {
     SUBCASE("Sets the output to silent if the option is provided") {
       const auto [context, data] = create_toml_mock("test", R"(output = "silent")");
 
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_output();
 
       CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
@@ -302,7 +610,8 @@ TEST_SUITE("Config::CommandBuilder") {
     SUBCASE("Sets the output to unchanged if the option is provided") {
       const auto [context, data] = create_toml_mock("test", R"(output = "unchanged")");
 
-      Litr::Config::CommandBuilder builder{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder{table, context, data, "test"};
       builder.add_output();
 
       CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
@@ -315,10 +624,11 @@ TEST_SUITE("Config::CommandBuilder") {
     SUBCASE("Sets a child command as reference") {
       const auto [context, data] = create_toml_mock("test", "");
 
-      Litr::Config::CommandBuilder builder_root{context, data, "test"};
-      Litr::Config::CommandBuilder builder_child{context, data, "test"};
+      Litr::Config::CommandTable table{};
+      Litr::Config::CommandBuilder builder_root{table, context, data, "test"};
+      Litr::Config::CommandBuilder builder_child{table, context, data, "test"};
 
-      builder_root.add_child_command(builder_child.get_result());
+      builder_root.add_child_command(*builder_child.get_result());
 
       CHECK_EQ(Litr::Error::Handler::get_errors().size(), 0);
       CHECK_EQ(builder_root.get_result()->child_commands.size(), 1);
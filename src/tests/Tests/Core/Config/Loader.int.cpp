@@ -6,6 +6,8 @@
 
 #include <doctest/doctest.h>
 
+#include <filesystem>
+#include <fstream>
 #include <memory>
 
 #include "Core/Config/Query.hpp"
@@ -102,7 +104,7 @@ TEST_SUITE("Config::Loader") {
 
   TEST_CASE("Does nothing if no commands or parameters defined") {
     const Litr::Path path{"../../Fixtures/Config/empty-commands-params.toml"};
-    const Litr::Config::Loader config{path};
+    Litr::Config::Loader config{path};
 
     CHECK_FALSE(Litr::Error::Handler::has_errors());
     CHECK_EQ(config.get_commands().size(), 0);
@@ -110,6 +112,150 @@ TEST_SUITE("Config::Loader") {
     Litr::Error::Handler::flush();
   }
 
+  TEST_CASE("Builds commands only once asked for in lazy mode") {
+    const Litr::Path path{"../../Fixtures/Config/lazy-commands.toml"};
+    Litr::Config::Loader config{path, Litr::Config::Loader::Mode::LAZY};
+
+    CHECK_FALSE(Litr::Error::Handler::has_errors());
+
+    SUBCASE("Builds a valid command without errors") {
+      const Litr::Config::Command* command{config.get_command("build")};
+
+      REQUIRE(command != nullptr);
+      CHECK_EQ(command->name, "build");
+      CHECK_EQ(command->child_commands.size(), 1);
+      CHECK_EQ(config.get_command("build"), command);
+      CHECK_EQ(config.get_command("unknown"), nullptr);
+      CHECK_FALSE(Litr::Error::Handler::has_errors());
+    }
+
+    SUBCASE("Reports errors of a command once it is built") {
+      static_cast<void>(config.get_command("update"));
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 1);
+
+      // Building all commands does not report the same error again.
+      CHECK_EQ(config.get_commands().size(), 2);
+      CHECK_EQ(Litr::Error::Handler::get_errors().size(), 1);
+    }
+
+    Litr::Error::Handler::flush();
+  }
+
+  TEST_CASE("Keeps the values of a lazily loaded file changed afterwards") {
+    const std::filesystem::path path{std::filesystem::temp_directory_path() / "litr-lazy.toml"};
+    std::ofstream{path} << "[commands]\nbuild = \"echo build\"\n";
+    Litr::Config::Loader config{Litr::Path{path.string()}, Litr::Config::Loader::Mode::LAZY};
+
+    std::ofstream{path, std::ios::trunc} << "[commands]\n";
+    const Litr::Config::Command* command{config.get_command("build")};
+
+    REQUIRE(command != nullptr);
+    REQUIRE_EQ(command->script.size(), 1);
+    CHECK_EQ(command->script[0], "echo build");
+    CHECK_FALSE(Litr::Error::Handler::has_errors());
+
+    std::filesystem::remove(path);
+    Litr::Error::Handler::flush();
+  }
+
+  TEST_CASE("Includes commands of other files under a namespace") {
+    const Litr::Path path{"../../Fixtures/Config/includes.toml"};
+    const auto config{std::make_shared<Litr::Config::Loader>(path)};
+    const auto errors{Litr::Error::Handler::get_errors()};
+
+    SUBCASE("Adds a command for every included file") {
+      CHECK_EQ(config->get_commands().size(), 4);
+    }
+
+    SUBCASE("Resolves commands of an included file") {
+      const Litr::Config::Query query{config};
+      const auto command{query.get_command("api.build")};
+
+      REQUIRE(command != nullptr);
+      CHECK_EQ(command->script.size(), 1);
+      CHECK_EQ(command->script[0], "echo api build");
+      CHECK_EQ(command->directory.size(), 1);
+      CHECK_EQ(command->directory[0], "../../Fixtures/Config/includes/packages/api/src");
+      CHECK_NE(query.get_command("web.start"), nullptr);
+    }
+
+    SUBCASE("Runs commands of an included file inside its directory") {
+      const Litr::Config::Query query{config};
+      const auto command{query.get_command("api.test")};
+
+      REQUIRE(command != nullptr);
+      CHECK_EQ(command->directory.size(), 1);
+      CHECK_EQ(command->directory[0], "../../Fixtures/Config/includes/packages/api/");
+    }
+
+    SUBCASE("Reports errors inside the included file") {
+      REQUIRE_EQ(errors.size(), 1);
+      CHECK_EQ(errors[0].location.file, "../../Fixtures/Config/includes/packages/broken/litr.toml");
+      CHECK_EQ(errors[0].location.line, 2);
+    }
+
+    Litr::Error::Handler::flush();
+  }
+
+  TEST_CASE("Emits an error if an include does not match any file") {
+    const Litr::Path path{"../../Fixtures/Config/include-missing.toml"};
+    const Litr::Config::Loader config{path};
+    const auto errors{Litr::Error::Handler::get_errors()};
+
+    CHECK_EQ(errors.size(), 1);
+    CHECK_EQ(errors[0].message, R"(There is no file to include for "missing/*/litr.toml".)");
+    Litr::Error::Handler::flush();
+  }
+
+  TEST_CASE("Adds parameters of included files") {
+    const Litr::Path path{"../../Fixtures/Config/include-params.toml"};
+    const Litr::Config::Loader config{path};
+    const auto errors{Litr::Error::Handler::get_errors()};
+    const auto params{config.get_parameters()};
+
+    REQUIRE_EQ(params.size(), 2);
+    CHECK_EQ(params[0]->name, "target");
+    CHECK_EQ(params[0]->description, "The target to build.");
+    CHECK_EQ(params[1]->name, "verbose");
+
+    REQUIRE_EQ(errors.size(), 2);
+    CHECK_EQ(errors[0].message, R"(The parameter name "target" is already used.)");
+    CHECK_EQ(errors[0].location.line, 6);
+    CHECK_EQ(errors[1].message,
+        R"(The field "settings" cannot be used in the included file )"
+        R"("../../Fixtures/Config/include-params/packages/api/litr.toml".)");
+    Litr::Error::Handler::flush();
+  }
+
+  TEST_CASE("Reads settings") {
+    const Litr::Path path{"../../Fixtures/Config/settings.toml"};
+    const auto config{std::make_shared<Litr::Config::Loader>(path)};
+
+    CHECK_FALSE(Litr::Error::Handler::has_errors());
+    CHECK_EQ(config->get_settings().resources.at("db"), 1);
+    CHECK_EQ(config->get_settings().resources.at("memory_gb"), 32);
+
+    const Litr::Config::Command* command{config->get_command("migrate")};
+    REQUIRE(command != nullptr);
+    REQUIRE_EQ(command->resources.size(), 2);
+    CHECK_EQ(command->resources[1].name, "memory_gb");
+    CHECK_EQ(command->resources[1].amount, 8);
+    Litr::Error::Handler::flush();
+  }
+
+  TEST_CASE("Emits errors on malformed settings") {
+    const Litr::Path path{"../../Fixtures/Config/settings-malformed.toml"};
+    const Litr::Config::Loader config{path};
+    const auto errors{Litr::Error::Handler::get_errors()};
+
+    REQUIRE_EQ(errors.size(), 2);
+    CHECK_EQ(errors[0].message,
+        R"(The "resources" setting can only be a table of positive whole numbers.)");
+    CHECK_EQ(errors[1].message, R"(The setting "unknown" is not known.)");
+    CHECK(config.get_settings().resources.empty());
+    Litr::Error::Handler::flush();
+  }
+
   TEST_CASE("Loads commands") {
     const Litr::Path path{"../../Fixtures/Config/commands-params.toml"};
     const auto config{std::make_shared<Litr::Config::Loader>(path)};
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/Config/TomlReader.hpp"
+
+#include <doctest/doctest.h>
+
+#include <string>
+
+/** @private */
+static bool read(const std::string& source, Litr::Config::Value& root) {
+  static Litr::StringPool strings{};
+  Litr::Config::TomlReader reader{source, strings};
+  return reader.read(root);
+}
+
+TEST_SUITE("Config::TomlReader") {
+  TEST_CASE("Reads an empty source as empty table") {
+    Litr::Config::Value root{};
+
+    CHECK(read("", root));
+    CHECK(root.is_table());
+    CHECK(root.as_table().empty());
+  }
+
+  TEST_CASE("Reads strings") {
+    const std::string source{
+        "basic = \"Hello\"\n"
+        "literal = 'C:\\path'\n"
+        "escaped = \"tab\\there \\\"quoted\\\" \\u00E9\\U0001F600\"\n"
+        "\"quoted key\" = \"\"\n"};
+    Litr::Config::Value root{};
+
+    REQUIRE(read(source, root));
+    CHECK_EQ(root.at("basic").as_string(), "Hello");
+    CHECK_EQ(root.at("literal").as_string(), "C:\\path");
+    CHECK_EQ(root.at("escaped").as_string(), "tab\there \"quoted\" \xC3\xA9\xF0\x9F\x98\x80");
+    CHECK_EQ(root.at("quoted key").as_string(), "");
+  }
+
+  TEST_CASE("Reads multi-line strings") {
+    const std::string source{
+        "basic = \"\"\"\nfirst\nsecond \\\n   third\"\"\"\n"
+        "literal = '''\nno \\escapes\n'''\n"
+        "quotes = \"\"\"\"quoted\"\"\"\"\"\n"
+        "after = \"\"\n"};
+    Litr::Config::Value root{};
+
+    REQUIRE(read(source, root));
+    CHECK_EQ(root.at("basic").as_string(), "first\nsecond third");
+    CHECK_EQ(root.at("literal").as_string(), "no \\escapes\n");
+    CHECK_EQ(root.at("quotes").as_string(), "\"quoted\"\"");
+    CHECK_EQ(root.at("after").location().line(), 9);
+  }
+
+  TEST_CASE("Reads decimal integers") {
+    const std::string source{
+        "zero = 0\n"
+        "positive = +42\n"
+        "negative = -17\n"
+        "separated = 1_000_000\n"
+        "inline = { count = 8 }\n"};
+    Litr::Config::Value root{};
+
+    REQUIRE(read(source, root));
+    CHECK(root.at("zero").is_integer());
+    CHECK_EQ(root.at("zero").as_integer(), 0);
+    CHECK_EQ(root.at("positive").as_integer(), 42);
+    CHECK_EQ(root.at("negative").as_integer(), -17);
+    CHECK_EQ(root.at("separated").as_integer(), 1000000);
+    CHECK_EQ(root.at("inline").at("count").as_integer(), 8);
+
+    CHECK_FALSE(read("a = 1__0\n", root));
+    CHECK_FALSE(read("a = 1_\n", root));
+    CHECK_FALSE(read("a = 99999999999999999999\n", root));
+  }
+
+  TEST_CASE("Reads arrays, inline tables and tables in order") {
+    const std::string source{
+        "# Comment\n"
+        "[commands]\n"
+        "build = [\n"
+        "  \"first\", # Comment\n"
+        "  'second',\n"
+        "]\n"
+        "run = { script = \"run\", description = \"Run it\" }\n"
+        "[commands.other.\"nested\"]\n"
+        "flag = true\n"
+        "[params]\n"};
+    Litr::Config::Value root{};
+
+    REQUIRE(read(source, root));
+    REQUIRE_EQ(root.as_table().size(), 2);
+    CHECK_EQ(root.as_table()[0].first, "commands");
+    CHECK_EQ(root.as_table()[1].first, "params");
+
+    const Litr::Config::Value& commands{root.at("commands")};
+    REQUIRE_EQ(commands.as_table().size(), 3);
+    CHECK_EQ(commands.as_table()[0].first, "build");
+    CHECK_EQ(commands.as_table()[1].first, "run");
+    CHECK_EQ(commands.as_table()[2].first, "other");
+
+    const Litr::Config::Value& build{commands.at("build")};
+    REQUIRE(build.is_array());
+    REQUIRE_EQ(build.as_array().size(), 2);
+    CHECK_EQ(build.as_array()[0].as_string(), "first");
+    CHECK_EQ(build.as_array()[1].as_string(), "second");
+
+    const Litr::Config::Value& run{commands.at("run")};
+    REQUIRE(run.is_table());
+    CHECK_EQ(run.at("script").as_string(), "run");
+    CHECK_EQ(run.at("description").as_string(), "Run it");
+
+    const Litr::Config::Value& nested{commands.at("other").at("nested")};
+    CHECK(nested.is_table());
+    CHECK_EQ(nested.at("flag").type(), Litr::Config::Value::Type::OTHER);
+  }
+
+  TEST_CASE("Keeps the source location of values") {
+    const std::string source{
+        "[commands]\n"
+        "scripts = [\"first line\", \"second line\"]\r\n"};
+    Litr::Config::Value root{};
+
+    REQUIRE(read(source, root));
+    const Litr::Config::Value& commands{root.at("commands")};
+    CHECK_EQ(commands.location().line(), 1);
+    CHECK_EQ(commands.location().column(), 2);
+
+    const Litr::Config::Value& scripts{commands.at("scripts")};
+    CHECK_EQ(scripts.location().line(), 2);
+    CHECK_EQ(scripts.location().column(), 11);
+    CHECK_EQ(scripts.location().line_str(), R"(scripts = ["first line", "second line"])");
+    CHECK_EQ(scripts.as_array()[0].location().column(), 12);
+    CHECK_EQ(scripts.as_array()[1].location().column(), 26);
+  }
+
+  TEST_CASE("Rejects what it does not support") {
+    Litr::Config::Value root{};
+
+    SUBCASE("Dotted keys") {
+      CHECK_FALSE(read("a.b = \"c\"\n", root));
+    }
+
+    SUBCASE("Numbers other than decimal integers") {
+      CHECK_FALSE(read("a = 1.5\n", root));
+      CHECK_FALSE(read("a = 1e3\n", root));
+      CHECK_FALSE(read("a = 0x1F\n", root));
+      CHECK_FALSE(read("a = 01\n", root));
+      CHECK_FALSE(read("a = 1979-05-27\n", root));
+    }
+
+    SUBCASE("Arrays of tables") {
+      CHECK_FALSE(read("[[a]]\n", root));
+    }
+
+    SUBCASE("A byte order mark") {
+      CHECK_FALSE(read("\xEF\xBB\xBF" "a = \"b\"\n", root));
+    }
+  }
+
+  TEST_CASE("Rejects invalid TOML") {
+    Litr::Config::Value root{};
+
+    SUBCASE("Duplicate keys") {
+      CHECK_FALSE(read("a = \"b\"\na = \"c\"\n", root));
+      CHECK_FALSE(read("a = { b = \"c\", b = \"d\" }\n", root));
+    }
+
+    SUBCASE("Tables defined twice") {
+      CHECK_FALSE(read("[a]\n[a]\n", root));
+      CHECK_FALSE(read("[a.b]\n[a.b]\n", root));
+    }
+
+    SUBCASE("Values redefined as table") {
+      CHECK_FALSE(read("a = \"b\"\n[a]\n", root));
+      CHECK_FALSE(read("[a]\nb = \"c\"\n[a.b]\n", root));
+    }
+
+    SUBCASE("Unterminated strings") {
+      CHECK_FALSE(read("a = \"b\n", root));
+      CHECK_FALSE(read("a = '''b\n", root));
+    }
+
+    SUBCASE("Invalid escape sequences") {
+      CHECK_FALSE(read("a = \"\\x\"\n", root));
+      CHECK_FALSE(read("a = \"\\uD800\"\n", root));
+    }
+
+    SUBCASE("Multiple values on one line") {
+      CHECK_FALSE(read("a = \"b\" c = \"d\"\n", root));
+    }
+
+    SUBCASE("A trailing comma in an inline table") {
+      CHECK_FALSE(read("a = { b = \"c\", }\n", root));
+    }
+  }
+
+  TEST_CASE("Allows implicit tables to be defined later") {
+    const std::string source{"[a.b]\n[a]\nc = \"d\"\n"};
+    Litr::Config::Value root{};
+
+    REQUIRE(read(source, root));
+    CHECK(root.at("a").at("b").is_table());
+    CHECK_EQ(root.at("a").at("c").as_string(), "d");
+    CHECK_EQ(root.at("a").location().line(), 2);
+  }
+}
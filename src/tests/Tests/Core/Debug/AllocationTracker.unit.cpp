@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/Debug/AllocationTracker.hpp"
+
+#include <doctest/doctest.h>
+
+using Litr::Debug::AllocationTracker;
+
+TEST_SUITE("Debug::AllocationTracker") {
+  TEST_CASE("Accounts allocations to the innermost phase") {
+    AllocationTracker::reset();
+
+    {
+      const Litr::Debug::AllocationPhase query{AllocationTracker::Phase::QUERY};
+      CHECK_EQ(AllocationTracker::record_allocation(100), AllocationTracker::Phase::QUERY);
+
+      {
+        const Litr::Debug::AllocationPhase compile{AllocationTracker::Phase::SCRIPT_COMPILE};
+        CHECK_EQ(AllocationTracker::record_allocation(20),
+            AllocationTracker::Phase::SCRIPT_COMPILE);
+      }
+
+      CHECK_EQ(AllocationTracker::record_allocation(30), AllocationTracker::Phase::QUERY);
+    }
+
+    CHECK_EQ(AllocationTracker::record_allocation(1), AllocationTracker::Phase::OTHER);
+
+    const AllocationTracker::Statistics query{
+        AllocationTracker::get_statistics(AllocationTracker::Phase::QUERY)};
+    CHECK_EQ(query.allocations, 2U);
+    CHECK_EQ(query.allocated_bytes, 130U);
+    CHECK_EQ(query.live_bytes, 130U);
+
+    const AllocationTracker::Statistics compile{
+        AllocationTracker::get_statistics(AllocationTracker::Phase::SCRIPT_COMPILE)};
+    CHECK_EQ(compile.allocations, 1U);
+    CHECK_EQ(compile.allocated_bytes, 20U);
+  }
+
+  TEST_CASE("Keeps the peak of live bytes after deallocations") {
+    AllocationTracker::reset();
+
+    const AllocationTracker::Phase phase{AllocationTracker::record_allocation(64)};
+    static_cast<void>(AllocationTracker::record_allocation(32));
+    AllocationTracker::record_deallocation(64, phase);
+
+    const AllocationTracker::Statistics statistics{AllocationTracker::get_statistics(phase)};
+    CHECK_EQ(statistics.allocations, 2U);
+    CHECK_EQ(statistics.deallocations, 1U);
+    CHECK_EQ(statistics.live_bytes, 32U);
+    CHECK_EQ(statistics.peak_live_bytes, 96U);
+    CHECK_EQ(AllocationTracker::get_peak_live_bytes(), 96U);
+  }
+}
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/FileLock.hpp"
+
+#include <doctest/doctest.h>
+
+#include <filesystem>
+
+TEST_SUITE("FileLock") {
+  TEST_CASE("Is only held by one at a time") {
+    const Litr::Path path{(std::filesystem::temp_directory_path() / "litr-lock").string()};
+
+    Litr::FileLock first{path};
+    Litr::FileLock second{path};
+    REQUIRE(first.is_open());
+    REQUIRE(second.is_open());
+
+    CHECK(first.try_lock());
+    CHECK_FALSE(second.try_lock());
+
+    first.unlock();
+    CHECK(second.try_lock());
+    second.unlock();
+
+    std::filesystem::remove(path.to_string());
+  }
+}
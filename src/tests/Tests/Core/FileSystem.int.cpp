@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/FileSystem.hpp"
+
+#include <doctest/doctest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+TEST_SUITE("FileSystem") {
+  TEST_CASE("get_absolute_path") {
+    const std::string current{std::filesystem::current_path().string()};
+
+    CHECK_EQ(Litr::FileSystem::get_absolute_path(Litr::Path{""}), current + "/");
+    CHECK_EQ(Litr::FileSystem::get_absolute_path(Litr::Path{"a/../b"}), current + "/b");
+    CHECK_EQ(Litr::FileSystem::get_absolute_path(Litr::Path{"/tmp/./a"}), "/tmp/a");
+  }
+
+  TEST_CASE("glob") {
+    SUBCASE("Finds files matching every part of a pattern") {
+      const Litr::Path directory{"../../Fixtures/Workspace/"};
+      const std::vector<Litr::Path> files{Litr::FileSystem::glob(directory, "packages/*/*.toml")};
+
+      REQUIRE_EQ(files.size(), 2);
+      CHECK_EQ(files[0], "../../Fixtures/Workspace/packages/api/litr.toml");
+      CHECK_EQ(files[1], "../../Fixtures/Workspace/packages/broken/litr.toml");
+    }
+  }
+
+  TEST_CASE("glob_directories") {
+    SUBCASE("Finds directories on one level") {
+      const std::vector<Litr::Path> directories{
+          Litr::FileSystem::glob_directories("../../Fixtures/Workspace/packages/*", true)};
+
+      REQUIRE_EQ(directories.size(), 3);
+      CHECK_EQ(directories[0], "../../Fixtures/Workspace/packages/api");
+      CHECK_EQ(directories[1], "../../Fixtures/Workspace/packages/broken");
+      CHECK_EQ(directories[2], "../../Fixtures/Workspace/packages/web");
+    }
+
+    SUBCASE("Finds directories on any level with a double star") {
+      const std::vector<Litr::Path> directories{
+          Litr::FileSystem::glob_directories("../../Fixtures/Workspace/**/", true)};
+
+      REQUIRE_EQ(directories.size(), 5);
+      CHECK_EQ(directories[0], "../../Fixtures/Workspace/");
+      CHECK_EQ(directories[1], "../../Fixtures/Workspace/packages");
+    }
+
+    SUBCASE("Keeps paths without wildcards if they exist") {
+      const std::string packages{"../../Fixtures/Workspace/packages"};
+      CHECK_EQ(Litr::FileSystem::glob_directories(packages, true).size(), 1);
+      CHECK(Litr::FileSystem::glob_directories("../../Fixtures/Workspace/unknown", true).empty());
+    }
+
+    SUBCASE("Skips directories ignored by git only if asked to") {
+      const std::filesystem::path root{
+          std::filesystem::temp_directory_path() / "litr-glob-directories"};
+      std::filesystem::create_directories(root / "build");
+      std::filesystem::create_directories(root / "src");
+      std::ofstream{root / ".gitignore"} << "build/\n";
+      const std::string pattern{(root / "*").string()};
+
+      const std::vector<Litr::Path> directories{
+          Litr::FileSystem::glob_directories(pattern, true)};
+      REQUIRE_EQ(directories.size(), 1);
+      CHECK_EQ(directories[0], (root / "src").string());
+      CHECK_EQ(Litr::FileSystem::glob_directories(pattern, false).size(), 2);
+
+      std::filesystem::remove_all(root);
+    }
+  }
+}
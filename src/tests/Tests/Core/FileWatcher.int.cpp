@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/FileWatcher.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+/** @private */
+static std::filesystem::path create_directory(const std::string& name) {
+  const std::filesystem::path directory{std::filesystem::temp_directory_path() / name};
+  std::filesystem::remove_all(directory);
+  std::filesystem::create_directories(directory);
+  return std::filesystem::canonical(directory);
+}
+
+/** @private */
+static bool contains(const Litr::FileWatcher::Files& files, const std::filesystem::path& path) {
+  return std::find(files.begin(), files.end(), path.string()) != files.end();
+}
+
+TEST_SUITE("FileWatcher") {
+  constexpr std::chrono::milliseconds quiet_period{10};
+
+  TEST_CASE("Reports changed files") {
+    if (!Litr::FileWatcher::is_supported()) {
+      return;
+    }
+
+    const std::filesystem::path directory{create_directory("litr-watch-changed")};
+    Litr::FileWatcher watcher{};
+    watcher.add_directory(Litr::Path{directory.string()});
+    CHECK_FALSE(watcher.has_changes());
+
+    std::ofstream{directory / "file.txt"} << "changed";
+    CHECK(watcher.has_changes());
+
+    const Litr::FileWatcher::Files files{watcher.wait(quiet_period)};
+    CHECK_EQ(files.size(), 1);
+    CHECK(contains(files, directory / "file.txt"));
+    CHECK_FALSE(watcher.has_changes());
+
+    std::filesystem::remove_all(directory);
+  }
+
+  TEST_CASE("Skips files git ignores") {
+    if (!Litr::FileWatcher::is_supported()) {
+      return;
+    }
+
+    const std::filesystem::path directory{create_directory("litr-watch-ignored")};
+    std::filesystem::create_directories(directory / "build");
+    std::ofstream{directory / ".gitignore"} << "*.log\nbuild/\n";
+
+    Litr::FileWatcher watcher{};
+    watcher.add_directory(Litr::Path{directory.string()});
+
+    std::ofstream{directory / "debug.log"} << "ignored";
+    std::ofstream{directory / "build" / "output.o"} << "ignored";
+    std::ofstream{directory / "main.cpp"} << "changed";
+
+    const Litr::FileWatcher::Files files{watcher.wait(quiet_period)};
+    CHECK_EQ(files.size(), 1);
+    CHECK(contains(files, directory / "main.cpp"));
+
+    std::filesystem::remove_all(directory);
+  }
+
+  TEST_CASE("Watches directories created later on") {
+    if (!Litr::FileWatcher::is_supported()) {
+      return;
+    }
+
+    const std::filesystem::path directory{create_directory("litr-watch-created")};
+    Litr::FileWatcher watcher{};
+    watcher.add_directory(Litr::Path{directory.string()});
+
+    std::filesystem::create_directories(directory / "package");
+    CHECK(contains(watcher.wait(quiet_period), directory / "package"));
+
+    std::ofstream{directory / "package" / "file.txt"} << "changed";
+    CHECK(contains(watcher.wait(quiet_period), directory / "package" / "file.txt"));
+
+    std::filesystem::remove_all(directory);
+  }
+}
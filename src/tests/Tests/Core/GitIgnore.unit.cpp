@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/GitIgnore.hpp"
+
+#include <doctest/doctest.h>
+
+TEST_SUITE("GitIgnore") {
+  TEST_CASE("is_ignored") {
+    SUBCASE("Ignores nothing without rules") {
+      const Litr::GitIgnore ignore{};
+
+      CHECK(ignore.empty());
+      CHECK_FALSE(ignore.is_ignored("build", true));
+    }
+
+    SUBCASE("Matches names on any level") {
+      Litr::GitIgnore ignore{};
+      ignore.add_rules("", "# Comment\n\n*.log\nnode_modules\n");
+
+      CHECK(ignore.is_ignored("debug.log", false));
+      CHECK(ignore.is_ignored("packages/api/debug.log", false));
+      CHECK(ignore.is_ignored("packages/api/node_modules", true));
+      CHECK_FALSE(ignore.is_ignored("packages/api/litr.toml", false));
+    }
+
+    SUBCASE("Matches directories only with a trailing slash") {
+      Litr::GitIgnore ignore{};
+      ignore.add_rules("", "build/\r\n");
+
+      CHECK(ignore.is_ignored("packages/build", true));
+      CHECK_FALSE(ignore.is_ignored("packages/build", false));
+    }
+
+    SUBCASE("Anchors patterns containing a slash") {
+      Litr::GitIgnore ignore{};
+      ignore.add_rules("", "/dist\ndocs/*/generated\nvendor/**/cache\n");
+
+      CHECK(ignore.is_ignored("dist", true));
+      CHECK_FALSE(ignore.is_ignored("packages/dist", true));
+      CHECK(ignore.is_ignored("docs/api/generated", true));
+      CHECK_FALSE(ignore.is_ignored("docs/api/v1/generated", true));
+      CHECK(ignore.is_ignored("vendor/cache", true));
+      CHECK(ignore.is_ignored("vendor/a/b/cache", true));
+    }
+
+    SUBCASE("Applies rules below their directory only") {
+      Litr::GitIgnore ignore{};
+      ignore.add_rules("packages/api", "/out\n");
+
+      CHECK(ignore.is_ignored("packages/api/out", true));
+      CHECK_FALSE(ignore.is_ignored("out", true));
+      CHECK_FALSE(ignore.is_ignored("packages/api-v2/out", true));
+    }
+
+    SUBCASE("Includes negated paths again") {
+      Litr::GitIgnore ignore{};
+      ignore.add_rules("", "*.toml\n");
+      ignore.add_rules("packages", "!litr.toml\n");
+
+      CHECK(ignore.is_ignored("config.toml", false));
+      CHECK(ignore.is_ignored("packages/config.toml", false));
+      CHECK_FALSE(ignore.is_ignored("packages/api/litr.toml", false));
+    }
+  }
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/Process.hpp"
+
+#include <doctest/doctest.h>
+
+#include <chrono>
+#include <csignal>
+#include <string>
+
+/** @private */
+static std::string run(const std::string& command, const Litr::Process::Limits& limits) {
+  std::string output{};
+  const Litr::Process::Result result{Litr::Process::run(
+      command, limits, [&output](const std::string& part) { output.append(part); })};
+  CHECK_EQ(result.exit_code, 0);
+  return output;
+}
+
+TEST_SUITE("Process") {
+  TEST_CASE("Passes on output and exit code") {
+    if (!Litr::Process::is_supported()) {
+      return;
+    }
+
+    std::string output{};
+    const Litr::Process::Result result{Litr::Process::run("echo out; echo err >&2; exit 3",
+        {},
+        [&output](const std::string& part) { output.append(part); })};
+
+    CHECK_EQ(result.exit_code, 3);
+    CHECK_FALSE(result.timed_out);
+    CHECK_EQ(output, "out\nerr\n");
+  }
+
+  TEST_CASE("Applies limits before the command runs") {
+    if (!Litr::Process::is_supported()) {
+      return;
+    }
+
+    Litr::Process::Limits limits{};
+    limits.nice = 19;
+    limits.cpus = {0};
+    limits.open_files = 64;
+    limits.memory = 4ULL * 1024 * 1024 * 1024;
+
+    CHECK_FALSE(limits.empty());
+    CHECK_EQ(run("ps -o nice= -p $$ | tr -d ' '", limits), "19\n");
+    CHECK_EQ(run("ulimit -n", limits), "64\n");
+#ifdef __linux__
+    CHECK_EQ(run("grep Cpus_allowed_list /proc/self/status | cut -f 2", limits), "0\n");
+    CHECK_EQ(run("ulimit -v", limits), "4194304\n");
+#endif
+  }
+
+// CPUs are only bound to on Linux, everywhere else the command just runs.
+#ifdef __linux__
+  TEST_CASE("Does not run a command its limits cannot be applied to") {
+    if (!Litr::Process::is_supported()) {
+      return;
+    }
+
+    Litr::Process::Limits limits{};
+    limits.cpus = {1023};
+
+    std::string output{};
+    const Litr::Process::Result result{Litr::Process::run(
+        "echo ran", limits, [&output](const std::string& part) { output.append(part); })};
+
+    CHECK_EQ(result.exit_code, 126);
+    CHECK_EQ(output, "litr: Could not bind the command to the given CPUs.\n");
+  }
+#endif
+
+  TEST_CASE("Ends a command and everything it started after its timeout") {
+    if (!Litr::Process::is_supported()) {
+      return;
+    }
+
+    Litr::Process::Limits limits{};
+    limits.timeout = std::chrono::seconds{1};
+
+    const auto start{std::chrono::steady_clock::now()};
+    const Litr::Process::Result result{
+        Litr::Process::run("sleep 30 & sleep 30; wait", limits, [](const std::string&) {})};
+
+    CHECK(result.timed_out);
+    CHECK_EQ(result.exit_code, 128 + SIGTERM);
+    CHECK_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds{5});
+  }
+
+  TEST_CASE("Kills a command not ending after its timeout") {
+    if (!Litr::Process::is_supported()) {
+      return;
+    }
+
+    Litr::Process::Limits limits{};
+    limits.timeout = std::chrono::seconds{1};
+
+    const Litr::Process::Result result{Litr::Process::run(
+        "trap '' TERM; sleep 30 & trap '' TERM; sleep 30", limits, [](const std::string&) {})};
+
+    CHECK(result.timed_out);
+    CHECK_EQ(result.exit_code, 128 + SIGKILL);
+  }
+
+  TEST_CASE("Ends a command and everything it started once cancelled") {
+    if (!Litr::Process::is_supported()) {
+      return;
+    }
+
+    const auto start{std::chrono::steady_clock::now()};
+    const Litr::Process::Result result{Litr::Process::run(
+        "sleep 30 & sleep 30; wait",
+        {},
+        [](const std::string&) {},
+        [&start]() { return std::chrono::steady_clock::now() - start > std::chrono::seconds{1}; })};
+
+    CHECK(result.cancelled);
+    CHECK_FALSE(result.timed_out);
+    CHECK_EQ(result.exit_code, 128 + SIGTERM);
+    CHECK_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds{5});
+  }
+
+  TEST_CASE("Stops reading output kept open outside of the ended group") {
+    if (!Litr::Process::is_supported() ||
+        Litr::Process::run("command -v setsid", {}, [](const std::string&) {}).exit_code != 0) {
+      return;
+    }
+
+    Litr::Process::Limits limits{};
+    limits.timeout = std::chrono::seconds{1};
+
+    // The session of its own takes the process out of the group, it keeps the output open.
+    const auto start{std::chrono::steady_clock::now()};
+    const Litr::Process::Result result{
+        Litr::Process::run("setsid sleep 10 & sleep 30", limits, [](const std::string&) {})};
+
+    CHECK(result.timed_out);
+    CHECK_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds{5});
+  }
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/ProcessTracer.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/** @private */
+static std::filesystem::path create_directory(const std::string& name) {
+  const std::filesystem::path directory{std::filesystem::temp_directory_path() / name};
+  std::filesystem::remove_all(directory);
+  std::filesystem::create_directories(directory);
+  return std::filesystem::canonical(directory);
+}
+
+/** @private */
+static bool contains(const std::vector<std::string>& files, const std::filesystem::path& path) {
+  return std::find(files.begin(), files.end(), path.string()) != files.end();
+}
+
+TEST_SUITE("ProcessTracer") {
+  TEST_CASE("Passes on output and exit code") {
+    if (!Litr::ProcessTracer::is_supported()) {
+      return;
+    }
+
+    std::string output{};
+    const Litr::ProcessTracer::Result result{Litr::ProcessTracer::run(
+        "echo out; echo err >&2; exit 3", {}, [&output](const std::string& part) {
+          output.append(part);
+        })};
+
+    CHECK_EQ(result.exit_code, 3);
+    CHECK_EQ(output, "out\nerr\n");
+  }
+
+  TEST_CASE("Records files of the command and its processes") {
+    if (!Litr::ProcessTracer::is_supported()) {
+      return;
+    }
+
+    const std::filesystem::path directory{create_directory("litr-trace")};
+    std::ofstream{directory / "input.txt"} << "input";
+
+    const Litr::ProcessTracer::Result result{Litr::ProcessTracer::run(
+        "cd " + directory.string() + " && cat input.txt missing.txt; (cat nested.txt) & wait",
+        {},
+        [](const std::string& /*output*/) {})};
+
+    CHECK(contains(result.files, directory / "input.txt"));
+    CHECK(contains(result.files, directory / "missing.txt"));
+    CHECK(contains(result.files, directory / "nested.txt"));
+    CHECK(std::is_sorted(result.files.begin(), result.files.end()));
+    CHECK(std::none_of(result.files.begin(), result.files.end(), [](const std::string& file) {
+      return file.rfind("/proc/", 0) == 0;
+    }));
+
+    std::filesystem::remove_all(directory);
+  }
+
+  TEST_CASE("Ends traced processes after their timeout") {
+    if (!Litr::ProcessTracer::is_supported()) {
+      return;
+    }
+
+    Litr::Process::Limits limits{};
+    limits.timeout = std::chrono::seconds{1};
+
+    const Litr::ProcessTracer::Result result{Litr::ProcessTracer::run(
+        "sleep 30 & sleep 30; wait", limits, [](const std::string& /*output*/) {})};
+
+    CHECK(result.timed_out);
+    CHECK_NE(result.exit_code, 0);
+  }
+
+  TEST_CASE("Ends traced processes once cancelled") {
+    if (!Litr::ProcessTracer::is_supported()) {
+      return;
+    }
+
+    const auto start{std::chrono::steady_clock::now()};
+    const Litr::ProcessTracer::Result result{Litr::ProcessTracer::run(
+        "sleep 30 & sleep 30; wait",
+        {},
+        [](const std::string& /*output*/) {},
+        [&start]() { return std::chrono::steady_clock::now() - start > std::chrono::seconds{1}; })};
+
+    CHECK(result.cancelled);
+    CHECK_FALSE(result.timed_out);
+    CHECK_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds{5});
+  }
+}
@@ -7,6 +7,7 @@
 #include <doctest/doctest.h>
 
 #include <array>
+#include <string>
 
 struct TokenDefinition {
   Litr::Script::TokenType type;
@@ -294,6 +295,27 @@ TEST_SUITE("script::Scanner") {
     check_eos_token(scanner);
   }
 
+  TEST_CASE("Long untouched runs with percentage signs and escaped sequences") {
+    const std::string untouched{std::string(4096, 'a') + R"( 100% \%{escaped} %)" +
+                                std::string(4096, '\n') + "% {"};
+    const std::string script{untouched + "%{name}" + untouched};
+    Litr::Script::Scanner scanner{script.c_str()};
+
+    std::array<TokenDefinition, 4> definition{{
+        {Litr::Script::TokenType::UNTOUCHED, untouched},
+        {Litr::Script::TokenType::START_SEQ, "%{"},
+        {Litr::Script::TokenType::IDENTIFIER, "name"},
+        {Litr::Script::TokenType::END_SEQ, "}"},
+    }};
+
+    check_definition(scanner, definition);
+
+    std::array<TokenDefinition, 1> rest{{{Litr::Script::TokenType::UNTOUCHED, untouched}}};
+
+    check_definition(scanner, rest);
+    check_eos_token(scanner);
+  }
+
   // Error cases
   TEST_CASE("Unterminated string") {
     Litr::Script::Scanner scanner{"echo %{'Hello}"};
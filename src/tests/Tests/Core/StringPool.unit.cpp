@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/StringPool.hpp"
+
+#include <doctest/doctest.h>
+
+#include <string>
+
+TEST_SUITE("StringPool") {
+  TEST_CASE("intern") {
+    SUBCASE("Returns a view on an equal string") {
+      Litr::StringPool pool{};
+      const std::string value{"build"};
+
+      CHECK_EQ(pool.intern(value), "build");
+      CHECK_NE(pool.intern(value).data(), value.data());
+    }
+
+    SUBCASE("Stores equal strings only once") {
+      Litr::StringPool pool{};
+
+      const std::string_view first{pool.intern("build")};
+      const std::string_view second{pool.intern(std::string{"build"})};
+      static_cast<void>(pool.intern("test"));
+
+      CHECK_EQ(first.data(), second.data());
+      CHECK_EQ(pool.size(), 2U);
+    }
+
+    SUBCASE("Keeps views valid when growing") {
+      Litr::StringPool pool{};
+
+      const std::string_view first{pool.intern("first")};
+      for (size_t index{0}; index < 10000; ++index) {
+        static_cast<void>(pool.intern(std::to_string(index)));
+      }
+
+      CHECK_EQ(first, "first");
+      CHECK_EQ(pool.size(), 10001U);
+    }
+
+    SUBCASE("Empty strings do not share an address with others") {
+      Litr::StringPool pool{};
+
+      const std::string_view empty{pool.intern("")};
+      const std::string_view next{pool.intern("next")};
+
+      CHECK_NE(empty.data(), next.data());
+      CHECK_EQ(empty, "");
+    }
+  }
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2022 Martin Helmut Fieber <info@martin-fieber.se>
+ */
+
+#include "Core/ThreadPool.hpp"
+
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <vector>
+
+TEST_SUITE("ThreadPool") {
+  TEST_CASE("run") {
+    SUBCASE("Runs the task once for every index") {
+      Litr::ThreadPool pool{4};
+      std::vector<std::atomic<size_t>> calls(1000);
+
+      pool.run(calls.size(), [&](size_t index) { ++calls[index]; });
+
+      for (auto&& call : calls) {
+        CHECK_EQ(call.load(), 1U);
+      }
+    }
+
+    SUBCASE("Can run multiple times") {
+      Litr::ThreadPool pool{2};
+      std::atomic<size_t> sum{0};
+
+      for (size_t run{0}; run < 100; ++run) {
+        pool.run(10, [&](size_t index) { sum += index; });
+      }
+
+      CHECK_EQ(sum.load(), 4500U);
+    }
+
+    SUBCASE("Runs on the calling thread without workers") {
+      Litr::ThreadPool pool{0};
+      size_t sum{0};
+
+      pool.run(5, [&](size_t index) { sum += index; });
+
+      CHECK_EQ(pool.size(), 0U);
+      CHECK_EQ(sum, 10U);
+    }
+
+    SUBCASE("Does nothing without tasks") {
+      Litr::ThreadPool pool{2};
+      bool called{false};
+
+      pool.run(0, [&](size_t /*index*/) { called = true; });
+
+      CHECK_FALSE(called);
+    }
+  }
+}
@@ -8,6 +8,7 @@
 
 #include <deque>
 #include <string>
+#include <string_view>
 #include <vector>
 
 TEST_SUITE("Utils") {
@@ -65,6 +66,23 @@ TEST_SUITE("Utils") {
       Litr::Utils::split_into(input, ' ', output);
       CHECK_EQ(output.size(), 1);
     }
+
+    SUBCASE("Views into the source") {
+      const std::string input{"path.to.somewhere"};
+      std::deque<std::string_view> output{};
+      Litr::Utils::split_into(input, '.', output);
+      CHECK_EQ(output.size(), 3);
+      CHECK_EQ(output[1], "to");
+      CHECK_EQ(output[1].data(), input.data() + 5);
+    }
+
+    SUBCASE("Keeps empty parts but no trailing one") {
+      const std::string input{"a,,b,"};
+      std::vector<std::string> output{};
+      Litr::Utils::split_into(input, ',', output);
+      CHECK_EQ(output.size(), 3);
+      CHECK(output[1].empty());
+    }
   }
 
   TEST_CASE("deduplicate") {
@@ -96,4 +114,158 @@ TEST_SUITE("Utils") {
       CHECK_EQ(Litr::Utils::replace(source, from, to), "This is an example");
     }
   }
+
+  TEST_CASE("matches_wildcard") {
+    SUBCASE("Matches equal strings") {
+      CHECK(Litr::Utils::matches_wildcard("litr.toml", "litr.toml"));
+      CHECK_FALSE(Litr::Utils::matches_wildcard("litr.toml", "litr.tom"));
+    }
+
+    SUBCASE("Matches any number of characters with a star") {
+      CHECK(Litr::Utils::matches_wildcard("litr.toml", "*.toml"));
+      CHECK(Litr::Utils::matches_wildcard("litr.toml", "*"));
+      CHECK(Litr::Utils::matches_wildcard("", "*"));
+      CHECK(Litr::Utils::matches_wildcard("package-a.toml", "package*a*.toml"));
+      CHECK_FALSE(Litr::Utils::matches_wildcard("litr.json", "*.toml"));
+    }
+
+    SUBCASE("Matches exactly one character with a question mark") {
+      CHECK(Litr::Utils::matches_wildcard("a1", "a?"));
+      CHECK_FALSE(Litr::Utils::matches_wildcard("a", "a?"));
+      CHECK_FALSE(Litr::Utils::matches_wildcard("a12", "a?"));
+    }
+  }
+
+  TEST_CASE("matches_glob") {
+    SUBCASE("Matches every part on its own") {
+      CHECK(Litr::Utils::matches_glob("packages/api", "packages/*"));
+      CHECK_FALSE(Litr::Utils::matches_glob("packages/api/src", "packages/*"));
+      CHECK_FALSE(Litr::Utils::matches_glob("services/api", "packages/*"));
+    }
+
+    SUBCASE("Matches any number of parts with a double star") {
+      CHECK(Litr::Utils::matches_glob("services", "services/**"));
+      CHECK(Litr::Utils::matches_glob("services/a/b", "services/**"));
+      CHECK(Litr::Utils::matches_glob("services/a/b/cache", "services/**/cache"));
+      CHECK_FALSE(Litr::Utils::matches_glob("services/a/b", "services/**/cache"));
+    }
+
+    SUBCASE("Matches hidden parts only if asked for") {
+      CHECK(Litr::Utils::matches_glob(".cache", "*"));
+      CHECK_FALSE(Litr::Utils::matches_glob(".cache", "*", false));
+      CHECK_FALSE(Litr::Utils::matches_glob("a/.cache/b", "a/**/b", false));
+      CHECK(Litr::Utils::matches_glob(".cache", ".*", false));
+    }
+  }
+
+  TEST_CASE("matches_glob_start") {
+    SUBCASE("Tells if a longer path could match") {
+      CHECK(Litr::Utils::matches_glob_start("", "packages/*"));
+      CHECK(Litr::Utils::matches_glob_start("packages", "packages/*"));
+      CHECK_FALSE(Litr::Utils::matches_glob_start("packages/api", "packages/*"));
+      CHECK_FALSE(Litr::Utils::matches_glob_start("services", "packages/*"));
+    }
+
+    SUBCASE("Always continues after a double star") {
+      CHECK(Litr::Utils::matches_glob_start("services/a/b", "services/**/cache"));
+      CHECK(Litr::Utils::matches_glob_start("services/a/b", "services/**"));
+      CHECK_FALSE(Litr::Utils::matches_glob_start(".git", "**", false));
+    }
+  }
+
+  TEST_CASE("parse_number") {
+    SUBCASE("Reads numbers fitting into the type") {
+      CHECK_EQ(*Litr::Utils::parse_number<size_t>("0"), 0);
+      CHECK_EQ(*Litr::Utils::parse_number<size_t>("42"), 42);
+      CHECK_EQ(*Litr::Utils::parse_number<uint8_t>("255"), 255);
+    }
+
+    SUBCASE("Rejects anything else") {
+      CHECK_FALSE(Litr::Utils::parse_number<size_t>("").has_value());
+      CHECK_FALSE(Litr::Utils::parse_number<size_t>("4x").has_value());
+      CHECK_FALSE(Litr::Utils::parse_number<size_t>("+4").has_value());
+      CHECK_FALSE(Litr::Utils::parse_number<int64_t>("-4").has_value());
+      CHECK_FALSE(Litr::Utils::parse_number<uint8_t>("256").has_value());
+    }
+  }
+
+  TEST_CASE("parse_duration") {
+    SUBCASE("Reads durations of every unit") {
+      CHECK_EQ(Litr::Utils::parse_duration("15s")->count(), 15);
+      CHECK_EQ(Litr::Utils::parse_duration("10m")->count(), 600);
+      CHECK_EQ(Litr::Utils::parse_duration("2h")->count(), 7200);
+      CHECK_EQ(Litr::Utils::parse_duration("1d")->count(), 86400);
+      CHECK_EQ(Litr::Utils::parse_duration("1h30m")->count(), 5400);
+    }
+
+    SUBCASE("Rejects anything else") {
+      CHECK_FALSE(Litr::Utils::parse_duration("").has_value());
+      CHECK_FALSE(Litr::Utils::parse_duration("10").has_value());
+      CHECK_FALSE(Litr::Utils::parse_duration("m").has_value());
+      CHECK_FALSE(Litr::Utils::parse_duration("10x").has_value());
+      CHECK_FALSE(Litr::Utils::parse_duration("-10m").has_value());
+      CHECK_FALSE(Litr::Utils::parse_duration("99999999999999999999s").has_value());
+      CHECK_FALSE(Litr::Utils::parse_duration("999999d").has_value());
+      CHECK_FALSE(Litr::Utils::parse_duration("100000d100000d").has_value());
+    }
+  }
+
+  TEST_CASE("parse_size") {
+    SUBCASE("Reads sizes of every unit") {
+      CHECK_EQ(*Litr::Utils::parse_size("512"), 512);
+      CHECK_EQ(*Litr::Utils::parse_size("64K"), 65536);
+      CHECK_EQ(*Litr::Utils::parse_size("256M"), 268435456);
+      CHECK_EQ(*Litr::Utils::parse_size("4G"), 4294967296ULL);
+      CHECK_EQ(*Litr::Utils::parse_size("1T"), 1099511627776ULL);
+    }
+
+    SUBCASE("Rejects anything else") {
+      CHECK_FALSE(Litr::Utils::parse_size("").has_value());
+      CHECK_FALSE(Litr::Utils::parse_size("G").has_value());
+      CHECK_FALSE(Litr::Utils::parse_size("4GB").has_value());
+      CHECK_FALSE(Litr::Utils::parse_size("4g").has_value());
+      CHECK_FALSE(Litr::Utils::parse_size("-4G").has_value());
+      CHECK_FALSE(Litr::Utils::parse_size("1.5G").has_value());
+      CHECK_FALSE(Litr::Utils::parse_size("999999999999T").has_value());
+      CHECK_FALSE(Litr::Utils::parse_size("18446744073709551616").has_value());
+    }
+  }
+
+  TEST_CASE("parse_cpus") {
+    SUBCASE("Reads numbers and ranges") {
+      const std::vector<size_t> single{3};
+      const std::vector<size_t> range{0, 1, 2, 3};
+      const std::vector<size_t> mixed{0, 1, 6};
+
+      CHECK_EQ(*Litr::Utils::parse_cpus("3"), single);
+      CHECK_EQ(*Litr::Utils::parse_cpus("0-3"), range);
+      CHECK_EQ(*Litr::Utils::parse_cpus("6,0-1,1"), mixed);
+    }
+
+    SUBCASE("Rejects anything else") {
+      CHECK_FALSE(Litr::Utils::parse_cpus("").has_value());
+      CHECK_FALSE(Litr::Utils::parse_cpus("3-1").has_value());
+      CHECK_FALSE(Litr::Utils::parse_cpus("0-").has_value());
+      CHECK_FALSE(Litr::Utils::parse_cpus("a").has_value());
+      CHECK_FALSE(Litr::Utils::parse_cpus("0,,1").has_value());
+      CHECK_FALSE(Litr::Utils::parse_cpus("1024").has_value());
+    }
+  }
+
+  TEST_CASE("hash") {
+    SUBCASE("Creates the same hash on every run") {
+      CHECK_EQ(Litr::Utils::hash(""), 0xcbf29ce484222325ULL);
+      CHECK_EQ(Litr::Utils::hash("a"), 0xaf63dc4c8601ec8cULL);
+      CHECK_NE(Litr::Utils::hash("ab"), Litr::Utils::hash("ba"));
+    }
+
+    SUBCASE("Continues hashing from a seed") {
+      CHECK_EQ(Litr::Utils::hash("b", Litr::Utils::hash("a")), Litr::Utils::hash("ab"));
+    }
+
+    SUBCASE("Formats a hash with a fixed length") {
+      CHECK_EQ(Litr::Utils::to_hex(0xaf63dc4c8601ec8cULL), "af63dc4c8601ec8c");
+      CHECK_EQ(Litr::Utils::to_hex(1), "0000000000000001");
+    }
+  }
 }